@@ -1,7 +1,11 @@
 #include "Commands/EpicUnrealMCPBlueprintCommands.h"
 #include "Commands/EpicUnrealMCPCommonUtils.h"
+#include "EpicUnrealMCPBridge.h"
+#include "EpicUnrealMCPActorIndex.h"
+#include "EpicUnrealMCPLog.h"
 #include "Engine/Blueprint.h"
 #include "Engine/BlueprintGeneratedClass.h"
+#include "Engine/Level.h"
 #include "Factories/BlueprintFactory.h"
 #include "EdGraphSchema_K2.h"
 #include "K2Node_Event.h"
@@ -23,6 +27,7 @@
 #include "Engine/SCS_Node.h"
 #include "UObject/Field.h"
 #include "UObject/FieldPath.h"
+#include "UObject/UObjectIterator.h"
 #include "EditorAssetLibrary.h"
 #include "AssetRegistry/AssetRegistryModule.h"
 #include "GameFramework/Actor.h"
@@ -31,61 +36,40 @@
 
 FEpicUnrealMCPBlueprintCommands::FEpicUnrealMCPBlueprintCommands()
 {
+    Handlers.Add(TEXT("create_blueprint"), [this](const TSharedPtr<FJsonObject>& Params) { return HandleCreateBlueprint(Params); });
+    Handlers.Add(TEXT("add_component_to_blueprint"), [this](const TSharedPtr<FJsonObject>& Params) { return HandleAddComponentToBlueprint(Params); });
+    Handlers.Add(TEXT("set_physics_properties"), [this](const TSharedPtr<FJsonObject>& Params) { return HandleSetPhysicsProperties(Params); });
+    Handlers.Add(TEXT("set_object_properties"), [this](const TSharedPtr<FJsonObject>& Params) { return HandleSetObjectProperties(Params); });
+    Handlers.Add(TEXT("compile_blueprint"), [this](const TSharedPtr<FJsonObject>& Params) { return HandleCompileBlueprint(Params); });
+    Handlers.Add(TEXT("compile_blueprints"), [this](const TSharedPtr<FJsonObject>& Params) { return HandleCompileBlueprints(Params); });
+    Handlers.Add(TEXT("set_static_mesh_properties"), [this](const TSharedPtr<FJsonObject>& Params) { return HandleSetStaticMeshProperties(Params); });
+    Handlers.Add(TEXT("spawn_blueprint_actor"), [this](const TSharedPtr<FJsonObject>& Params) { return HandleSpawnBlueprintActor(Params); });
+    Handlers.Add(TEXT("set_mesh_material_color"), [this](const TSharedPtr<FJsonObject>& Params) { return HandleSetMeshMaterialColor(Params); });
+    Handlers.Add(TEXT("set_mesh_material_colors"), [this](const TSharedPtr<FJsonObject>& Params) { return HandleSetMeshMaterialColors(Params); });
+    // Material management commands
+    Handlers.Add(TEXT("get_available_materials"), [this](const TSharedPtr<FJsonObject>& Params) { return HandleGetAvailableMaterials(Params); });
+    Handlers.Add(TEXT("apply_material_to_actor"), [this](const TSharedPtr<FJsonObject>& Params) { return HandleApplyMaterialToActor(Params); });
+    Handlers.Add(TEXT("apply_material_to_blueprint"), [this](const TSharedPtr<FJsonObject>& Params) { return HandleApplyMaterialToBlueprint(Params); });
+    Handlers.Add(TEXT("get_actor_material_info"), [this](const TSharedPtr<FJsonObject>& Params) { return HandleGetActorMaterialInfo(Params); });
+    Handlers.Add(TEXT("get_blueprint_material_info"), [this](const TSharedPtr<FJsonObject>& Params) { return HandleGetBlueprintMaterialInfo(Params); });
 }
 
 TSharedPtr<FJsonObject> FEpicUnrealMCPBlueprintCommands::HandleCommand(const FString& CommandType, const TSharedPtr<FJsonObject>& Params)
 {
-    if (CommandType == TEXT("create_blueprint"))
-    {
-        return HandleCreateBlueprint(Params);
-    }
-    else if (CommandType == TEXT("add_component_to_blueprint"))
-    {
-        return HandleAddComponentToBlueprint(Params);
-    }
-    else if (CommandType == TEXT("set_physics_properties"))
-    {
-        return HandleSetPhysicsProperties(Params);
-    }
-    else if (CommandType == TEXT("compile_blueprint"))
-    {
-        return HandleCompileBlueprint(Params);
-    }
-    else if (CommandType == TEXT("set_static_mesh_properties"))
-    {
-        return HandleSetStaticMeshProperties(Params);
-    }
-    else if (CommandType == TEXT("spawn_blueprint_actor"))
-    {
-        return HandleSpawnBlueprintActor(Params);
-    }
-    else if (CommandType == TEXT("set_mesh_material_color"))
-    {
-        return HandleSetMeshMaterialColor(Params);
-    }
-    // Material management commands
-    else if (CommandType == TEXT("get_available_materials"))
-    {
-        return HandleGetAvailableMaterials(Params);
-    }
-    else if (CommandType == TEXT("apply_material_to_actor"))
-    {
-        return HandleApplyMaterialToActor(Params);
-    }
-    else if (CommandType == TEXT("apply_material_to_blueprint"))
+    if (const FHandlerFunction* Handler = Handlers.Find(FName(*CommandType)))
     {
-        return HandleApplyMaterialToBlueprint(Params);
+        return (*Handler)(Params);
     }
-    else if (CommandType == TEXT("get_actor_material_info"))
-    {
-        return HandleGetActorMaterialInfo(Params);
-    }
-    else if (CommandType == TEXT("get_blueprint_material_info"))
+
+    return FEpicUnrealMCPCommonUtils::CreateErrorResponse(FString::Printf(TEXT("Unknown blueprint command: %s"), *CommandType));
+}
+
+void FEpicUnrealMCPBlueprintCommands::RegisterCommands(UEpicUnrealMCPBridge* Bridge)
+{
+    for (const TPair<FName, FHandlerFunction>& Pair : Handlers)
     {
-        return HandleGetBlueprintMaterialInfo(Params);
+        Bridge->RegisterCommand(Pair.Key, Pair.Value);
     }
-    
-    return FEpicUnrealMCPCommonUtils::CreateErrorResponse(FString::Printf(TEXT("Unknown blueprint command: %s"), *CommandType));
 }
 
 TSharedPtr<FJsonObject> FEpicUnrealMCPBlueprintCommands::HandleCreateBlueprint(const TSharedPtr<FJsonObject>& Params)
@@ -357,6 +341,80 @@ TSharedPtr<FJsonObject> FEpicUnrealMCPBlueprintCommands::HandleSetPhysicsPropert
     return ResultObj;
 }
 
+TSharedPtr<FJsonObject> FEpicUnrealMCPBlueprintCommands::HandleSetObjectProperties(const TSharedPtr<FJsonObject>& Params)
+{
+    // Get required parameters
+    FString BlueprintName;
+    if (!Params->TryGetStringField(TEXT("blueprint_name"), BlueprintName))
+    {
+        return FEpicUnrealMCPCommonUtils::CreateErrorResponse(TEXT("Missing 'blueprint_name' parameter"));
+    }
+
+    const TSharedPtr<FJsonObject>* Properties = nullptr;
+    if (!Params->TryGetObjectField(TEXT("properties"), Properties) || !Properties->IsValid())
+    {
+        return FEpicUnrealMCPCommonUtils::CreateErrorResponse(TEXT("Missing 'properties' object parameter"));
+    }
+
+    // Find the blueprint
+    UBlueprint* Blueprint = FEpicUnrealMCPCommonUtils::FindBlueprint(BlueprintName);
+    if (!Blueprint)
+    {
+        return FEpicUnrealMCPCommonUtils::CreateErrorResponse(FString::Printf(TEXT("Blueprint not found: %s"), *BlueprintName));
+    }
+
+    // Resolve the target: a named component template, or the class default
+    // object when no component is given
+    UObject* Target = nullptr;
+    FString ComponentName;
+    if (Params->TryGetStringField(TEXT("component_name"), ComponentName))
+    {
+        for (USCS_Node* Node : Blueprint->SimpleConstructionScript->GetAllNodes())
+        {
+            if (Node && Node->GetVariableName().ToString() == ComponentName)
+            {
+                Target = Node->ComponentTemplate;
+                break;
+            }
+        }
+
+        if (!Target)
+        {
+            return FEpicUnrealMCPCommonUtils::CreateErrorResponse(FString::Printf(TEXT("Component not found: %s"), *ComponentName));
+        }
+    }
+    else
+    {
+        Target = Blueprint->GeneratedClass ? Blueprint->GeneratedClass->GetDefaultObject() : nullptr;
+        if (!Target)
+        {
+            return FEpicUnrealMCPCommonUtils::CreateErrorResponse(FString::Printf(TEXT("Blueprint has no generated class (compile it first): %s"), *BlueprintName));
+        }
+    }
+
+    // Apply the whole batch in one call; one failed property does not stop
+    // the rest, and the property lookups are cached per class
+    TArray<FString> Errors;
+    const int32 SetCount = FEpicUnrealMCPCommonUtils::SetObjectProperties(Target, *Properties, Errors);
+
+    if (SetCount > 0)
+    {
+        FBlueprintEditorUtils::MarkBlueprintAsModified(Blueprint);
+    }
+
+    TSharedPtr<FJsonObject> ResultObj = MakeShared<FJsonObject>();
+    ResultObj->SetStringField(TEXT("target"), ComponentName.IsEmpty() ? TEXT("default_object") : *ComponentName);
+    ResultObj->SetNumberField(TEXT("set_count"), SetCount);
+
+    TArray<TSharedPtr<FJsonValue>> ErrorValues;
+    for (const FString& Error : Errors)
+    {
+        ErrorValues.Add(MakeShared<FJsonValueString>(Error));
+    }
+    ResultObj->SetArrayField(TEXT("errors"), ErrorValues);
+    return ResultObj;
+}
+
 TSharedPtr<FJsonObject> FEpicUnrealMCPBlueprintCommands::HandleCompileBlueprint(const TSharedPtr<FJsonObject>& Params)
 {
     // Get required parameters
@@ -382,9 +440,104 @@ TSharedPtr<FJsonObject> FEpicUnrealMCPBlueprintCommands::HandleCompileBlueprint(
     return ResultObj;
 }
 
+TSharedPtr<FJsonObject> FEpicUnrealMCPBlueprintCommands::HandleCompileBlueprints(const TSharedPtr<FJsonObject>& Params)
+{
+    // Collect the candidate set: an explicit name list, or every loaded
+    // blueprint when all_modified is set (clean ones are skipped below)
+    TArray<UBlueprint*> Candidates;
+    TArray<TSharedPtr<FJsonValue>> Errors;
+
+    bool bAllModified = false;
+    Params->TryGetBoolField(TEXT("all_modified"), bAllModified);
+
+    const TArray<TSharedPtr<FJsonValue>>* NamesArray = nullptr;
+    if (Params->TryGetArrayField(TEXT("blueprint_names"), NamesArray))
+    {
+        for (const TSharedPtr<FJsonValue>& NameValue : *NamesArray)
+        {
+            FString BlueprintName;
+            if (!NameValue.IsValid() || !NameValue->TryGetString(BlueprintName))
+            {
+                Errors.Add(MakeShared<FJsonValueString>(TEXT("Entry is not a string")));
+                continue;
+            }
+
+            UBlueprint* Blueprint = FEpicUnrealMCPCommonUtils::FindBlueprint(BlueprintName);
+            if (!Blueprint)
+            {
+                Errors.Add(MakeShared<FJsonValueString>(FString::Printf(TEXT("Blueprint not found: %s"), *BlueprintName)));
+                continue;
+            }
+
+            Candidates.AddUnique(Blueprint);
+        }
+    }
+    else if (bAllModified)
+    {
+        for (TObjectIterator<UBlueprint> It; It; ++It)
+        {
+            if (It->IsAsset())
+            {
+                Candidates.Add(*It);
+            }
+        }
+    }
+    else
+    {
+        return FEpicUnrealMCPCommonUtils::CreateErrorResponse(TEXT("Provide a 'blueprint_names' array or 'all_modified': true"));
+    }
+
+    // force=true recompiles clean blueprints too
+    bool bForce = false;
+    Params->TryGetBoolField(TEXT("force"), bForce);
+
+    TArray<TSharedPtr<FJsonValue>> BlueprintResults;
+    BlueprintResults.Reserve(Candidates.Num());
+    int32 CompiledCount = 0;
+    int32 SkippedCount = 0;
+    const double BatchStartTime = FPlatformTime::Seconds();
+
+    for (UBlueprint* Blueprint : Candidates)
+    {
+        TSharedPtr<FJsonObject> EntryObj = MakeShared<FJsonObject>();
+        EntryObj->SetStringField(TEXT("name"), Blueprint->GetName());
+
+        // Up-to-date blueprints skip the compiler entirely; redundant
+        // recompiles are most of the pipeline's wall time
+        const bool bUpToDate = Blueprint->Status == BS_UpToDate || Blueprint->Status == BS_UpToDateWithWarnings;
+        if (bUpToDate && !bForce)
+        {
+            EntryObj->SetStringField(TEXT("action"), TEXT("skipped"));
+            BlueprintResults.Add(MakeShared<FJsonValueObject>(EntryObj));
+            ++SkippedCount;
+            continue;
+        }
+
+        const double CompileStartTime = FPlatformTime::Seconds();
+        FKismetEditorUtilities::CompileBlueprint(Blueprint);
+
+        EntryObj->SetStringField(TEXT("action"), TEXT("compiled"));
+        EntryObj->SetNumberField(TEXT("compile_ms"), (FPlatformTime::Seconds() - CompileStartTime) * 1000.0);
+        EntryObj->SetBoolField(TEXT("has_errors"), Blueprint->Status == BS_Error);
+        BlueprintResults.Add(MakeShared<FJsonValueObject>(EntryObj));
+        ++CompiledCount;
+    }
+
+    TSharedPtr<FJsonObject> ResultObj = MakeShared<FJsonObject>();
+    ResultObj->SetNumberField(TEXT("compiled_count"), CompiledCount);
+    ResultObj->SetNumberField(TEXT("skipped_count"), SkippedCount);
+    ResultObj->SetNumberField(TEXT("total_ms"), (FPlatformTime::Seconds() - BatchStartTime) * 1000.0);
+    ResultObj->SetArrayField(TEXT("blueprints"), BlueprintResults);
+    if (Errors.Num() > 0)
+    {
+        ResultObj->SetArrayField(TEXT("errors"), Errors);
+    }
+    return ResultObj;
+}
+
 TSharedPtr<FJsonObject> FEpicUnrealMCPBlueprintCommands::HandleSpawnBlueprintActor(const TSharedPtr<FJsonObject>& Params)
 {
-    UE_LOG(LogTemp, Warning, TEXT("HandleSpawnBlueprintActor: Starting blueprint actor spawn"));
+    MCP_VERBOSE_LOG(TEXT("HandleSpawnBlueprintActor: Starting blueprint actor spawn"));
     
     // Get required parameters
     FString BlueprintName;
@@ -401,7 +554,7 @@ TSharedPtr<FJsonObject> FEpicUnrealMCPBlueprintCommands::HandleSpawnBlueprintAct
         return FEpicUnrealMCPCommonUtils::CreateErrorResponse(TEXT("Missing 'actor_name' parameter"));
     }
 
-    UE_LOG(LogTemp, Warning, TEXT("HandleSpawnBlueprintActor: Looking for blueprint '%s'"), *BlueprintName);
+    MCP_VERBOSE_LOG(TEXT("HandleSpawnBlueprintActor: Looking for blueprint '%s'"), *BlueprintName);
 
     // Find the blueprint
     UBlueprint* Blueprint = FEpicUnrealMCPCommonUtils::FindBlueprint(BlueprintName);
@@ -411,7 +564,7 @@ TSharedPtr<FJsonObject> FEpicUnrealMCPBlueprintCommands::HandleSpawnBlueprintAct
         return FEpicUnrealMCPCommonUtils::CreateErrorResponse(FString::Printf(TEXT("Blueprint not found: %s"), *BlueprintName));
     }
 
-    UE_LOG(LogTemp, Warning, TEXT("HandleSpawnBlueprintActor: Blueprint found, getting transform parameters"));
+    MCP_VERBOSE_LOG(TEXT("HandleSpawnBlueprintActor: Blueprint found, getting transform parameters"));
 
     // Get transform parameters
     FVector Location(0.0f, 0.0f, 0.0f);
@@ -420,15 +573,15 @@ TSharedPtr<FJsonObject> FEpicUnrealMCPBlueprintCommands::HandleSpawnBlueprintAct
     if (Params->HasField(TEXT("location")))
     {
         Location = FEpicUnrealMCPCommonUtils::GetVectorFromJson(Params, TEXT("location"));
-        UE_LOG(LogTemp, Warning, TEXT("HandleSpawnBlueprintActor: Location set to (%f, %f, %f)"), Location.X, Location.Y, Location.Z);
+        MCP_VERBOSE_LOG(TEXT("HandleSpawnBlueprintActor: Location set to (%f, %f, %f)"), Location.X, Location.Y, Location.Z);
     }
     if (Params->HasField(TEXT("rotation")))
     {
         Rotation = FEpicUnrealMCPCommonUtils::GetRotatorFromJson(Params, TEXT("rotation"));
-        UE_LOG(LogTemp, Warning, TEXT("HandleSpawnBlueprintActor: Rotation set to (%f, %f, %f)"), Rotation.Pitch, Rotation.Yaw, Rotation.Roll);
+        MCP_VERBOSE_LOG(TEXT("HandleSpawnBlueprintActor: Rotation set to (%f, %f, %f)"), Rotation.Pitch, Rotation.Yaw, Rotation.Roll);
     }
 
-    UE_LOG(LogTemp, Warning, TEXT("HandleSpawnBlueprintActor: Getting editor world"));
+    MCP_VERBOSE_LOG(TEXT("HandleSpawnBlueprintActor: Getting editor world"));
 
     // Spawn the actor
     UWorld* World = GEditor->GetEditorWorldContext().World();
@@ -438,7 +591,7 @@ TSharedPtr<FJsonObject> FEpicUnrealMCPBlueprintCommands::HandleSpawnBlueprintAct
         return FEpicUnrealMCPCommonUtils::CreateErrorResponse(TEXT("Failed to get editor world"));
     }
 
-    UE_LOG(LogTemp, Warning, TEXT("HandleSpawnBlueprintActor: Creating spawn transform"));
+    MCP_VERBOSE_LOG(TEXT("HandleSpawnBlueprintActor: Creating spawn transform"));
 
     FTransform SpawnTransform;
     SpawnTransform.SetLocation(Location);
@@ -447,23 +600,23 @@ TSharedPtr<FJsonObject> FEpicUnrealMCPBlueprintCommands::HandleSpawnBlueprintAct
     // Add a small delay to allow the engine to process the newly compiled class
     FPlatformProcess::Sleep(0.2f);
 
-    UE_LOG(LogTemp, Warning, TEXT("HandleSpawnBlueprintActor: About to spawn actor from blueprint '%s' with GeneratedClass: %s"), 
+    MCP_VERBOSE_LOG(TEXT("HandleSpawnBlueprintActor: About to spawn actor from blueprint '%s' with GeneratedClass: %s"), 
            *BlueprintName, Blueprint->GeneratedClass ? *Blueprint->GeneratedClass->GetName() : TEXT("NULL"));
 
     AActor* NewActor = World->SpawnActor<AActor>(Blueprint->GeneratedClass, SpawnTransform);
     
-    UE_LOG(LogTemp, Warning, TEXT("HandleSpawnBlueprintActor: SpawnActor completed, NewActor: %s"), 
+    MCP_VERBOSE_LOG(TEXT("HandleSpawnBlueprintActor: SpawnActor completed, NewActor: %s"), 
            NewActor ? *NewActor->GetName() : TEXT("NULL"));
     
     if (NewActor)
     {
-        UE_LOG(LogTemp, Warning, TEXT("HandleSpawnBlueprintActor: Setting actor label to '%s'"), *ActorName);
+        MCP_VERBOSE_LOG(TEXT("HandleSpawnBlueprintActor: Setting actor label to '%s'"), *ActorName);
         NewActor->SetActorLabel(*ActorName);
         
-        UE_LOG(LogTemp, Warning, TEXT("HandleSpawnBlueprintActor: About to convert actor to JSON"));
+        MCP_VERBOSE_LOG(TEXT("HandleSpawnBlueprintActor: About to convert actor to JSON"));
         TSharedPtr<FJsonObject> Result = FEpicUnrealMCPCommonUtils::ActorToJsonObject(NewActor, true);
         
-        UE_LOG(LogTemp, Warning, TEXT("HandleSpawnBlueprintActor: JSON conversion completed, returning result"));
+        MCP_VERBOSE_LOG(TEXT("HandleSpawnBlueprintActor: JSON conversion completed, returning result"));
         return Result;
     }
 
@@ -544,6 +697,42 @@ TSharedPtr<FJsonObject> FEpicUnrealMCPBlueprintCommands::HandleSetStaticMeshProp
     return ResultObj;
 }
 
+TMap<FString, TWeakObjectPtr<UMaterialInstanceDynamic>> FEpicUnrealMCPBlueprintCommands::ColoredMaterialCache;
+
+UMaterialInstanceDynamic* FEpicUnrealMCPBlueprintCommands::GetOrCreateColoredMaterial(UObject* Outer, UMaterialInterface* BaseMaterial, const FName& ParameterName, const FLinearColor& Color)
+{
+    // Quantize to 8 bits per channel for the key; palette entries closer
+    // than that are visually the same coloring. The outer is part of the
+    // key so instances are only shared within one package - a cross-package
+    // reference would break saving.
+    const FColor Quantized = Color.ToFColor(/*bSRGB=*/false);
+    const FString CacheKey = FString::Printf(TEXT("%s|%s|%s|%02X%02X%02X%02X"),
+        *GetPathNameSafe(Outer), *BaseMaterial->GetPathName(), *ParameterName.ToString(),
+        Quantized.R, Quantized.G, Quantized.B, Quantized.A);
+
+    if (TWeakObjectPtr<UMaterialInstanceDynamic>* Cached = ColoredMaterialCache.Find(CacheKey))
+    {
+        if (UMaterialInstanceDynamic* Existing = Cached->Get())
+        {
+            return Existing;
+        }
+        // Instance was GC'd after its last user went away; recreate below
+        ColoredMaterialCache.Remove(CacheKey);
+    }
+
+    // Parented to the caller's outer (level or component template), not a
+    // transient object, so the shared instance saves with the meshes that
+    // reference it
+    UMaterialInstanceDynamic* DynMaterial = UMaterialInstanceDynamic::Create(BaseMaterial, Outer);
+    if (DynMaterial)
+    {
+        DynMaterial->SetVectorParameterValue(ParameterName, Color);
+        ColoredMaterialCache.Add(CacheKey, DynMaterial);
+    }
+
+    return DynMaterial;
+}
+
 TSharedPtr<FJsonObject> FEpicUnrealMCPBlueprintCommands::HandleSetMeshMaterialColor(const TSharedPtr<FJsonObject>& Params)
 {
     // Get required parameters
@@ -643,16 +832,14 @@ TSharedPtr<FJsonObject> FEpicUnrealMCPBlueprintCommands::HandleSetMeshMaterialCo
         }
     }
 
-    // Create a dynamic material instance
-    UMaterialInstanceDynamic* DynMaterial = UMaterialInstanceDynamic::Create(Material, PrimComponent);
+    // Reuse the shared instance for this (material, color) pairing; the
+    // template is the outer so the instance saves inside the blueprint
+    UMaterialInstanceDynamic* DynMaterial = GetOrCreateColoredMaterial(PrimComponent, Material, FName(*ParameterName), Color);
     if (!DynMaterial)
     {
         return FEpicUnrealMCPCommonUtils::CreateErrorResponse(TEXT("Failed to create dynamic material instance"));
     }
 
-    // Set the color parameter
-    DynMaterial->SetVectorParameterValue(*ParameterName, Color);
-
     // Apply the material to the component
     PrimComponent->SetMaterial(MaterialSlot, DynMaterial);
 
@@ -679,6 +866,270 @@ TSharedPtr<FJsonObject> FEpicUnrealMCPBlueprintCommands::HandleSetMeshMaterialCo
     return ResultObj;
 }
 
+TSharedPtr<FJsonObject> FEpicUnrealMCPBlueprintCommands::HandleSetMeshMaterialColors(const TSharedPtr<FJsonObject>& Params)
+{
+    const TArray<TSharedPtr<FJsonValue>>* ActorsArray;
+    if (!Params->TryGetArrayField(TEXT("actors"), ActorsArray))
+    {
+        return FEpicUnrealMCPCommonUtils::CreateErrorResponse(TEXT("Missing 'actors' array parameter"));
+    }
+
+    UWorld* World = GEditor->GetEditorWorldContext().World();
+    if (!World)
+    {
+        return FEpicUnrealMCPCommonUtils::CreateErrorResponse(TEXT("Failed to get editor world"));
+    }
+
+    // Batch-wide defaults; individual entries can override each of them
+    int32 DefaultMaterialSlot = 0;
+    if (Params->HasField(TEXT("material_slot")))
+    {
+        DefaultMaterialSlot = Params->GetIntegerField(TEXT("material_slot"));
+    }
+
+    FString DefaultParameterName = TEXT("BaseColor");
+    Params->TryGetStringField(TEXT("parameter_name"), DefaultParameterName);
+
+    UMaterialInterface* DefaultMaterial = nullptr;
+    FString DefaultMaterialPath;
+    if (Params->TryGetStringField(TEXT("material_path"), DefaultMaterialPath))
+    {
+        DefaultMaterial = Cast<UMaterialInterface>(UEditorAssetLibrary::LoadAsset(DefaultMaterialPath));
+        if (!DefaultMaterial)
+        {
+            return FEpicUnrealMCPCommonUtils::CreateErrorResponse(FString::Printf(TEXT("Failed to load material: %s"), *DefaultMaterialPath));
+        }
+    }
+
+    FEpicUnrealMCPActorIndex& ActorIndex = FEpicUnrealMCPActorIndex::Get();
+    TSet<UMaterialInstanceDynamic*> InstancesUsed;
+    TArray<TSharedPtr<FJsonValue>> Errors;
+    int32 UpdatedCount = 0;
+
+    for (const TSharedPtr<FJsonValue>& EntryValue : *ActorsArray)
+    {
+        const TSharedPtr<FJsonObject>* Entry;
+        if (!EntryValue.IsValid() || !EntryValue->TryGetObject(Entry))
+        {
+            Errors.Add(MakeShared<FJsonValueString>(TEXT("Entry is not an object")));
+            continue;
+        }
+
+        FString ActorName;
+        if (!(*Entry)->TryGetStringField(TEXT("name"), ActorName))
+        {
+            Errors.Add(MakeShared<FJsonValueString>(TEXT("Entry missing 'name' field")));
+            continue;
+        }
+
+        const TArray<TSharedPtr<FJsonValue>>* ColorJsonArray;
+        if (!(*Entry)->TryGetArrayField(TEXT("color"), ColorJsonArray) || ColorJsonArray->Num() != 4)
+        {
+            Errors.Add(MakeShared<FJsonValueString>(FString::Printf(TEXT("%s: 'color' must be an array of 4 float values [R, G, B, A]"), *ActorName)));
+            continue;
+        }
+
+        FLinearColor Color(
+            FMath::Clamp((*ColorJsonArray)[0]->AsNumber(), 0.0f, 1.0f),
+            FMath::Clamp((*ColorJsonArray)[1]->AsNumber(), 0.0f, 1.0f),
+            FMath::Clamp((*ColorJsonArray)[2]->AsNumber(), 0.0f, 1.0f),
+            FMath::Clamp((*ColorJsonArray)[3]->AsNumber(), 0.0f, 1.0f));
+
+        AActor* TargetActor = ActorIndex.FindActorByName(World, ActorName);
+        if (!TargetActor)
+        {
+            Errors.Add(MakeShared<FJsonValueString>(FString::Printf(TEXT("Actor not found: %s"), *ActorName)));
+            continue;
+        }
+
+        int32 MaterialSlot = DefaultMaterialSlot;
+        if ((*Entry)->HasField(TEXT("material_slot")))
+        {
+            MaterialSlot = (*Entry)->GetIntegerField(TEXT("material_slot"));
+        }
+
+        FString ParameterName = DefaultParameterName;
+        (*Entry)->TryGetStringField(TEXT("parameter_name"), ParameterName);
+
+        TArray<UStaticMeshComponent*> MeshComponents;
+        TargetActor->GetComponents<UStaticMeshComponent>(MeshComponents);
+        if (MeshComponents.Num() == 0)
+        {
+            Errors.Add(MakeShared<FJsonValueString>(FString::Printf(TEXT("No mesh components found on actor: %s"), *ActorName)));
+            continue;
+        }
+
+        bool bAppliedToAny = false;
+        for (UStaticMeshComponent* MeshComp : MeshComponents)
+        {
+            if (!MeshComp)
+            {
+                continue;
+            }
+
+            // Per-entry base material override, then the batch default, then
+            // whatever the slot currently holds
+            UMaterialInterface* BaseMaterial = DefaultMaterial;
+            FString MaterialPath;
+            if ((*Entry)->TryGetStringField(TEXT("material_path"), MaterialPath))
+            {
+                BaseMaterial = Cast<UMaterialInterface>(UEditorAssetLibrary::LoadAsset(MaterialPath));
+            }
+            if (!BaseMaterial)
+            {
+                BaseMaterial = MeshComp->GetMaterial(MaterialSlot);
+            }
+            if (!BaseMaterial)
+            {
+                BaseMaterial = Cast<UMaterialInterface>(UEditorAssetLibrary::LoadAsset(TEXT("/Engine/BasicShapes/BasicShapeMaterial")));
+            }
+            if (!BaseMaterial)
+            {
+                continue;
+            }
+
+            // An existing cached instance must not be re-parameterized - peel
+            // back to its parent so identical colorings keep deduplicating
+            if (UMaterialInstanceDynamic* ExistingInstance = Cast<UMaterialInstanceDynamic>(BaseMaterial))
+            {
+                BaseMaterial = ExistingInstance->Parent ? ExistingInstance->Parent.Get() : BaseMaterial;
+            }
+
+            // Outered to the actor's level: every mesh in that level with
+            // this (material, color) pairing shares the instance and it
+            // saves with the map; town builders color thousands of cubes
+            // from a handful of palette entries
+            UMaterialInstanceDynamic* DynMaterial = GetOrCreateColoredMaterial(TargetActor->GetLevel(), BaseMaterial, FName(*ParameterName), Color);
+            if (!DynMaterial)
+            {
+                continue;
+            }
+
+            MeshComp->SetMaterial(MaterialSlot, DynMaterial);
+            InstancesUsed.Add(DynMaterial);
+            bAppliedToAny = true;
+        }
+
+        if (!bAppliedToAny)
+        {
+            Errors.Add(MakeShared<FJsonValueString>(FString::Printf(TEXT("Failed to apply material on actor: %s"), *ActorName)));
+            continue;
+        }
+
+        ++UpdatedCount;
+    }
+
+    TSharedPtr<FJsonObject> ResultObj = MakeShared<FJsonObject>();
+    ResultObj->SetNumberField(TEXT("updated_count"), UpdatedCount);
+    ResultObj->SetNumberField(TEXT("unique_materials"), InstancesUsed.Num());
+    if (Errors.Num() > 0)
+    {
+        ResultObj->SetArrayField(TEXT("errors"), Errors);
+    }
+    return ResultObj;
+}
+
+// Cached material catalog state
+TArray<FMCPMaterialCatalogEntry> FEpicUnrealMCPBlueprintCommands::MaterialCatalog;
+bool FEpicUnrealMCPBlueprintCommands::bMaterialCatalogBuilt = false;
+bool FEpicUnrealMCPBlueprintCommands::bMaterialCatalogDelegatesRegistered = false;
+
+bool FEpicUnrealMCPBlueprintCommands::IsMaterialAsset(const FAssetData& AssetData)
+{
+    const FTopLevelAssetPath ClassPath = AssetData.AssetClassPath;
+    return ClassPath == UMaterial::StaticClass()->GetClassPathName() ||
+           ClassPath == UMaterialInterface::StaticClass()->GetClassPathName() ||
+           ClassPath == UMaterialInstanceConstant::StaticClass()->GetClassPathName() ||
+           ClassPath == UMaterialInstanceDynamic::StaticClass()->GetClassPathName();
+}
+
+void FEpicUnrealMCPBlueprintCommands::EnsureMaterialCatalogBuilt()
+{
+    FAssetRegistryModule& AssetRegistryModule = FModuleManager::LoadModuleChecked<FAssetRegistryModule>(TEXT("AssetRegistry"));
+    IAssetRegistry& AssetRegistry = AssetRegistryModule.Get();
+
+    if (!bMaterialCatalogDelegatesRegistered)
+    {
+        AssetRegistry.OnAssetAdded().AddStatic(&FEpicUnrealMCPBlueprintCommands::OnMaterialAssetAdded);
+        AssetRegistry.OnAssetRemoved().AddStatic(&FEpicUnrealMCPBlueprintCommands::OnMaterialAssetRemoved);
+        AssetRegistry.OnAssetRenamed().AddStatic(&FEpicUnrealMCPBlueprintCommands::OnMaterialAssetRenamed);
+        bMaterialCatalogDelegatesRegistered = true;
+    }
+
+    if (bMaterialCatalogBuilt)
+    {
+        return;
+    }
+
+    // One full registry walk; afterwards the delegates keep the catalog current
+    FARFilter Filter;
+    Filter.ClassPaths.Add(UMaterialInterface::StaticClass()->GetClassPathName());
+    Filter.ClassPaths.Add(UMaterial::StaticClass()->GetClassPathName());
+    Filter.ClassPaths.Add(UMaterialInstanceConstant::StaticClass()->GetClassPathName());
+    Filter.ClassPaths.Add(UMaterialInstanceDynamic::StaticClass()->GetClassPathName());
+    Filter.PackagePaths.Add(TEXT("/Game/"));
+    Filter.PackagePaths.Add(TEXT("/Engine/"));
+    Filter.bRecursivePaths = true;
+
+    TArray<FAssetData> AssetDataArray;
+    AssetRegistry.GetAssets(Filter, AssetDataArray);
+
+    MaterialCatalog.Reset(AssetDataArray.Num());
+    for (const FAssetData& AssetData : AssetDataArray)
+    {
+        FMCPMaterialCatalogEntry& Entry = MaterialCatalog.AddDefaulted_GetRef();
+        Entry.Name = AssetData.AssetName.ToString();
+        Entry.Path = AssetData.GetObjectPathString();
+        Entry.Package = AssetData.PackageName.ToString();
+        Entry.Class = AssetData.AssetClassPath.ToString();
+    }
+
+    bMaterialCatalogBuilt = true;
+    UE_LOG(LogTemp, Log, TEXT("Material catalog built with %d entries"), MaterialCatalog.Num());
+}
+
+void FEpicUnrealMCPBlueprintCommands::OnMaterialAssetAdded(const FAssetData& AssetData)
+{
+    if (!bMaterialCatalogBuilt || !IsMaterialAsset(AssetData))
+    {
+        return;
+    }
+
+    FMCPMaterialCatalogEntry& Entry = MaterialCatalog.AddDefaulted_GetRef();
+    Entry.Name = AssetData.AssetName.ToString();
+    Entry.Path = AssetData.GetObjectPathString();
+    Entry.Package = AssetData.PackageName.ToString();
+    Entry.Class = AssetData.AssetClassPath.ToString();
+}
+
+void FEpicUnrealMCPBlueprintCommands::OnMaterialAssetRemoved(const FAssetData& AssetData)
+{
+    if (!bMaterialCatalogBuilt || !IsMaterialAsset(AssetData))
+    {
+        return;
+    }
+
+    const FString RemovedPath = AssetData.GetObjectPathString();
+    MaterialCatalog.RemoveAll([&RemovedPath](const FMCPMaterialCatalogEntry& Entry)
+    {
+        return Entry.Path == RemovedPath;
+    });
+}
+
+void FEpicUnrealMCPBlueprintCommands::OnMaterialAssetRenamed(const FAssetData& AssetData, const FString& OldObjectPath)
+{
+    if (!bMaterialCatalogBuilt || !IsMaterialAsset(AssetData))
+    {
+        return;
+    }
+
+    MaterialCatalog.RemoveAll([&OldObjectPath](const FMCPMaterialCatalogEntry& Entry)
+    {
+        return Entry.Path == OldObjectPath;
+    });
+    OnMaterialAssetAdded(AssetData);
+}
+
 TSharedPtr<FJsonObject> FEpicUnrealMCPBlueprintCommands::HandleGetAvailableMaterials(const TSharedPtr<FJsonObject>& Params)
 {
     // Get parameters - make search path completely dynamic
@@ -688,123 +1139,125 @@ TSharedPtr<FJsonObject> FEpicUnrealMCPBlueprintCommands::HandleGetAvailableMater
         // Default to empty string to search everywhere
         SearchPath = TEXT("");
     }
-    
+
     bool bIncludeEngineMaterials = true;
     if (Params->HasField(TEXT("include_engine_materials")))
     {
         bIncludeEngineMaterials = Params->GetBoolField(TEXT("include_engine_materials"));
     }
 
-    // Get asset registry module
-    FAssetRegistryModule& AssetRegistryModule = FModuleManager::LoadModuleChecked<FAssetRegistryModule>(TEXT("AssetRegistry"));
-    IAssetRegistry& AssetRegistry = AssetRegistryModule.Get();
-
-    // Create filter for materials
-    FARFilter Filter;
-    Filter.ClassPaths.Add(UMaterialInterface::StaticClass()->GetClassPathName());
-    Filter.ClassPaths.Add(UMaterial::StaticClass()->GetClassPathName());
-    Filter.ClassPaths.Add(UMaterialInstanceConstant::StaticClass()->GetClassPathName());
-    Filter.ClassPaths.Add(UMaterialInstanceDynamic::StaticClass()->GetClassPathName());
-    
-    // Add search paths dynamically
+    // Normalize the search path the same way the old registry filter did
     if (!SearchPath.IsEmpty())
     {
-        // Ensure the path starts with /
         if (!SearchPath.StartsWith(TEXT("/")))
         {
             SearchPath = TEXT("/") + SearchPath;
         }
-        // Ensure the path ends with / for proper directory search
         if (!SearchPath.EndsWith(TEXT("/")))
         {
             SearchPath += TEXT("/");
         }
-        Filter.PackagePaths.Add(*SearchPath);
-        UE_LOG(LogTemp, Log, TEXT("Searching for materials in: %s"), *SearchPath);
     }
-    else
-    {
-        // Search in common game content locations
-        Filter.PackagePaths.Add(TEXT("/Game/"));
-        UE_LOG(LogTemp, Log, TEXT("Searching for materials in all game content"));
-    }
-    
-    if (bIncludeEngineMaterials)
-    {
-        Filter.PackagePaths.Add(TEXT("/Engine/"));
-        UE_LOG(LogTemp, Log, TEXT("Including Engine materials in search"));
-    }
-    
-    Filter.bRecursivePaths = true;
 
-    // Get assets from registry
-    TArray<FAssetData> AssetDataArray;
-    AssetRegistry.GetAssets(Filter, AssetDataArray);
-    
-    UE_LOG(LogTemp, Log, TEXT("Asset registry found %d materials"), AssetDataArray.Num());
+    // Answer from the cached catalog instead of re-walking the registry
+    EnsureMaterialCatalogBuilt();
 
-    // Also try manual search using EditorAssetLibrary for more comprehensive results
-    TArray<FString> AllAssetPaths;
-    if (!SearchPath.IsEmpty())
-    {
-        AllAssetPaths = UEditorAssetLibrary::ListAssets(SearchPath, true, false);
-    }
-    else
-    {
-        AllAssetPaths = UEditorAssetLibrary::ListAssets(TEXT("/Game/"), true, false);
-    }
-    
-    // Filter for materials from the manual search
-    for (const FString& AssetPath : AllAssetPaths)
+    TArray<TSharedPtr<FJsonValue>> MaterialArray;
+
+    // The catalog only indexes /Game and /Engine; searches under other
+    // mounted roots (plugin content) are answered with a live registry
+    // query so they keep working, just without the cache
+    const bool bOutsideCatalog = !SearchPath.IsEmpty()
+        && !SearchPath.StartsWith(TEXT("/Game/"))
+        && !SearchPath.StartsWith(TEXT("/Engine/"));
+    if (bOutsideCatalog)
     {
-        if (AssetPath.Contains(TEXT("Material")) && !AssetPath.Contains(TEXT(".uasset")))
+        FAssetRegistryModule& AssetRegistryModule = FModuleManager::LoadModuleChecked<FAssetRegistryModule>(TEXT("AssetRegistry"));
+
+        FARFilter Filter;
+        Filter.ClassPaths.Add(UMaterialInterface::StaticClass()->GetClassPathName());
+        Filter.ClassPaths.Add(UMaterial::StaticClass()->GetClassPathName());
+        Filter.ClassPaths.Add(UMaterialInstanceConstant::StaticClass()->GetClassPathName());
+        Filter.ClassPaths.Add(UMaterialInstanceDynamic::StaticClass()->GetClassPathName());
+        Filter.PackagePaths.Add(FName(*SearchPath.LeftChop(1)));
+        Filter.bRecursivePaths = true;
+
+        TArray<FAssetData> AssetDataArray;
+        AssetRegistryModule.Get().GetAssets(Filter, AssetDataArray);
+
+        for (const FAssetData& AssetData : AssetDataArray)
         {
-            UObject* Asset = UEditorAssetLibrary::LoadAsset(AssetPath);
-            if (Asset && Asset->IsA<UMaterialInterface>())
+            TSharedPtr<FJsonObject> MaterialObj = MakeShared<FJsonObject>();
+            MaterialObj->SetStringField(TEXT("name"), AssetData.AssetName.ToString());
+            MaterialObj->SetStringField(TEXT("path"), AssetData.GetObjectPathString());
+            MaterialObj->SetStringField(TEXT("package"), AssetData.PackageName.ToString());
+            MaterialObj->SetStringField(TEXT("class"), AssetData.AssetClassPath.ToString());
+
+            MaterialArray.Add(MakeShared<FJsonValueObject>(MaterialObj));
+        }
+
+        // Engine materials are still appended from the catalog when asked
+        // for, matching the catalog path's behavior below
+        if (bIncludeEngineMaterials)
+        {
+            for (const FMCPMaterialCatalogEntry& Entry : MaterialCatalog)
             {
-                // Check if we already have this asset from registry search
-                bool bAlreadyFound = false;
-                for (const FAssetData& ExistingData : AssetDataArray)
-                {
-                    if (ExistingData.GetObjectPathString() == AssetPath)
-                    {
-                        bAlreadyFound = true;
-                        break;
-                    }
-                }
-                
-                if (!bAlreadyFound)
+                if (!Entry.Package.StartsWith(TEXT("/Engine/")))
                 {
-                    // Create FAssetData manually for this asset
-                    FAssetData ManualAssetData(Asset);
-                    AssetDataArray.Add(ManualAssetData);
+                    continue;
                 }
+
+                TSharedPtr<FJsonObject> MaterialObj = MakeShared<FJsonObject>();
+                MaterialObj->SetStringField(TEXT("name"), Entry.Name);
+                MaterialObj->SetStringField(TEXT("path"), Entry.Path);
+                MaterialObj->SetStringField(TEXT("package"), Entry.Package);
+                MaterialObj->SetStringField(TEXT("class"), Entry.Class);
+
+                MaterialArray.Add(MakeShared<FJsonValueObject>(MaterialObj));
             }
         }
-    }
 
-    UE_LOG(LogTemp, Log, TEXT("Total materials found after manual search: %d"), AssetDataArray.Num());
+        TSharedPtr<FJsonObject> ResultObj = MakeShared<FJsonObject>();
+        ResultObj->SetArrayField(TEXT("materials"), MaterialArray);
+        ResultObj->SetNumberField(TEXT("count"), MaterialArray.Num());
+        ResultObj->SetStringField(TEXT("search_path_used"), SearchPath);
 
-    // Convert to JSON
-    TArray<TSharedPtr<FJsonValue>> MaterialArray;
-    for (const FAssetData& AssetData : AssetDataArray)
+        return ResultObj;
+    }
+
+    for (const FMCPMaterialCatalogEntry& Entry : MaterialCatalog)
     {
+        const bool bIsEngineMaterial = Entry.Package.StartsWith(TEXT("/Engine/"));
+
+        if (!SearchPath.IsEmpty())
+        {
+            // An explicit search path filters directly; engine content is
+            // still appended when requested
+            const bool bMatchesSearchPath = (Entry.Package + TEXT("/")).StartsWith(SearchPath);
+            if (!bMatchesSearchPath && !(bIncludeEngineMaterials && bIsEngineMaterial))
+            {
+                continue;
+            }
+        }
+        else if (bIsEngineMaterial && !bIncludeEngineMaterials)
+        {
+            continue;
+        }
+
         TSharedPtr<FJsonObject> MaterialObj = MakeShared<FJsonObject>();
-        MaterialObj->SetStringField(TEXT("name"), AssetData.AssetName.ToString());
-        MaterialObj->SetStringField(TEXT("path"), AssetData.GetObjectPathString());
-        MaterialObj->SetStringField(TEXT("package"), AssetData.PackageName.ToString());
-        MaterialObj->SetStringField(TEXT("class"), AssetData.AssetClassPath.ToString());
-        
+        MaterialObj->SetStringField(TEXT("name"), Entry.Name);
+        MaterialObj->SetStringField(TEXT("path"), Entry.Path);
+        MaterialObj->SetStringField(TEXT("package"), Entry.Package);
+        MaterialObj->SetStringField(TEXT("class"), Entry.Class);
+
         MaterialArray.Add(MakeShared<FJsonValueObject>(MaterialObj));
-        
-        UE_LOG(LogTemp, Verbose, TEXT("Found material: %s at %s"), *AssetData.AssetName.ToString(), *AssetData.GetObjectPathString());
     }
 
     TSharedPtr<FJsonObject> ResultObj = MakeShared<FJsonObject>();
     ResultObj->SetArrayField(TEXT("materials"), MaterialArray);
     ResultObj->SetNumberField(TEXT("count"), MaterialArray.Num());
     ResultObj->SetStringField(TEXT("search_path_used"), SearchPath.IsEmpty() ? TEXT("/Game/") : SearchPath);
-    
+
     return ResultObj;
 }
 
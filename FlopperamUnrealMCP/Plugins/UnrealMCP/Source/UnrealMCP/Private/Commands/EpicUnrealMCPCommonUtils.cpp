@@ -1,4 +1,7 @@
 #include "Commands/EpicUnrealMCPCommonUtils.h"
+#include "Editor.h"
+#include "EpicUnrealMCPLog.h"
+#include "Serialization/MemoryWriter.h"
 #include "GameFramework/Actor.h"
 #include "Engine/Blueprint.h"
 #include "EdGraph/EdGraph.h"
@@ -44,10 +47,20 @@ TSharedPtr<FJsonObject> FEpicUnrealMCPCommonUtils::CreateSuccessResponse(const T
     {
         ResponseObject->SetObjectField(TEXT("data"), Data);
     }
-    
+
     return ResponseObject;
 }
 
+void FEpicUnrealMCPCommonUtils::SerializeJsonToUtf8(const TSharedRef<FJsonObject>& Json, TArray<uint8>& OutBytes)
+{
+    // The UTF8CHAR writer emits bytes directly into the array, so the
+    // response never exists as a TCHAR string that would need transcoding
+    FMemoryWriter MemoryWriter(OutBytes);
+    TSharedRef<TJsonWriter<UTF8CHAR>> Writer = TJsonWriter<UTF8CHAR>::Create(&MemoryWriter);
+    FJsonSerializer::Serialize(Json, Writer);
+    Writer->Close();
+}
+
 void FEpicUnrealMCPCommonUtils::GetIntArrayFromJson(const TSharedPtr<FJsonObject>& JsonObject, const FString& FieldName, TArray<int32>& OutArray)
 {
     OutArray.Reset();
@@ -146,9 +159,68 @@ FRotator FEpicUnrealMCPCommonUtils::GetRotatorFromJson(const TSharedPtr<FJsonObj
 }
 
 // Blueprint Utilities
+TMap<FString, TWeakObjectPtr<UBlueprint>> FEpicUnrealMCPCommonUtils::BlueprintCache;
+bool FEpicUnrealMCPCommonUtils::bBlueprintCacheDelegatesRegistered = false;
+TMap<TPair<FObjectKey, FName>, FProperty*> FEpicUnrealMCPCommonUtils::PropertyLookupCache;
+bool FEpicUnrealMCPCommonUtils::bPropertyCacheDelegateRegistered = false;
+
+void FEpicUnrealMCPCommonUtils::EnsureBlueprintCacheDelegates()
+{
+    if (bBlueprintCacheDelegatesRegistered)
+    {
+        return;
+    }
+
+    FAssetRegistryModule& AssetRegistryModule = FModuleManager::LoadModuleChecked<FAssetRegistryModule>(TEXT("AssetRegistry"));
+    IAssetRegistry& AssetRegistry = AssetRegistryModule.Get();
+    AssetRegistry.OnAssetAdded().AddStatic(&FEpicUnrealMCPCommonUtils::OnAssetAdded);
+    AssetRegistry.OnAssetRemoved().AddStatic(&FEpicUnrealMCPCommonUtils::OnAssetRemoved);
+    AssetRegistry.OnAssetRenamed().AddStatic(&FEpicUnrealMCPCommonUtils::OnAssetRenamed);
+    bBlueprintCacheDelegatesRegistered = true;
+}
+
+void FEpicUnrealMCPCommonUtils::OnAssetAdded(const FAssetData& AssetData)
+{
+    // A new asset under a cached name invalidates that entry
+    BlueprintCache.Remove(AssetData.AssetName.ToString());
+}
+
+void FEpicUnrealMCPCommonUtils::OnAssetRemoved(const FAssetData& AssetData)
+{
+    BlueprintCache.Remove(AssetData.AssetName.ToString());
+}
+
+void FEpicUnrealMCPCommonUtils::OnAssetRenamed(const FAssetData& AssetData, const FString& OldObjectPath)
+{
+    BlueprintCache.Remove(AssetData.AssetName.ToString());
+
+    // Drop the entry cached under the old name as well
+    FString OldAssetName;
+    if (OldObjectPath.Split(TEXT("."), nullptr, &OldAssetName, ESearchCase::CaseSensitive, ESearchDir::FromEnd))
+    {
+        BlueprintCache.Remove(OldAssetName);
+    }
+}
+
 UBlueprint* FEpicUnrealMCPCommonUtils::FindBlueprint(const FString& BlueprintName)
 {
-    return FindBlueprintByName(BlueprintName);
+    EnsureBlueprintCacheDelegates();
+
+    if (const TWeakObjectPtr<UBlueprint>* Cached = BlueprintCache.Find(BlueprintName))
+    {
+        if (UBlueprint* Blueprint = Cached->Get())
+        {
+            return Blueprint;
+        }
+        BlueprintCache.Remove(BlueprintName);
+    }
+
+    UBlueprint* Blueprint = FindBlueprintByName(BlueprintName);
+    if (Blueprint)
+    {
+        BlueprintCache.Add(BlueprintName, Blueprint);
+    }
+    return Blueprint;
 }
 
 UBlueprint* FEpicUnrealMCPCommonUtils::FindBlueprintByName(const FString& BlueprintName)
@@ -486,6 +558,50 @@ TSharedPtr<FJsonValue> FEpicUnrealMCPCommonUtils::ActorToJson(AActor* Actor)
     return MakeShared<FJsonValueObject>(ActorObject);
 }
 
+FMCPActorSnapshot FEpicUnrealMCPCommonUtils::SnapshotActor(AActor* Actor)
+{
+    FMCPActorSnapshot Snapshot;
+    Snapshot.Name = Actor->GetName();
+    Snapshot.Class = Actor->GetClass()->GetName();
+    Snapshot.Location = Actor->GetActorLocation();
+    Snapshot.Rotation = Actor->GetActorRotation();
+    Snapshot.Scale = Actor->GetActorScale3D();
+    return Snapshot;
+}
+
+void FEpicUnrealMCPCommonUtils::WriteActorSnapshotJson(TJsonWriter<UTF8CHAR>& Writer, const FMCPActorSnapshot& Snapshot)
+{
+    Writer.WriteObjectStart();
+    Writer.WriteValue(TEXT("name"), Snapshot.Name);
+    Writer.WriteValue(TEXT("class"), Snapshot.Class);
+
+    Writer.WriteArrayStart(TEXT("location"));
+    Writer.WriteValue(Snapshot.Location.X);
+    Writer.WriteValue(Snapshot.Location.Y);
+    Writer.WriteValue(Snapshot.Location.Z);
+    Writer.WriteArrayEnd();
+
+    Writer.WriteArrayStart(TEXT("rotation"));
+    Writer.WriteValue(Snapshot.Rotation.Pitch);
+    Writer.WriteValue(Snapshot.Rotation.Yaw);
+    Writer.WriteValue(Snapshot.Rotation.Roll);
+    Writer.WriteArrayEnd();
+
+    Writer.WriteArrayStart(TEXT("scale"));
+    Writer.WriteValue(Snapshot.Scale.X);
+    Writer.WriteValue(Snapshot.Scale.Y);
+    Writer.WriteValue(Snapshot.Scale.Z);
+    Writer.WriteArrayEnd();
+
+    Writer.WriteObjectEnd();
+}
+
+void FEpicUnrealMCPCommonUtils::WriteActorJson(TJsonWriter<UTF8CHAR>& Writer, AActor* Actor)
+{
+    // The snapshot lives on the stack; only the two name strings allocate
+    WriteActorSnapshotJson(Writer, SnapshotActor(Actor));
+}
+
 TSharedPtr<FJsonObject> FEpicUnrealMCPCommonUtils::ActorToJsonObject(AActor* Actor, bool bDetailed)
 {
     if (!Actor)
@@ -542,7 +658,46 @@ UK2Node_Event* FEpicUnrealMCPCommonUtils::FindExistingEventNode(UEdGraph* Graph,
     return nullptr;
 }
 
-bool FEpicUnrealMCPCommonUtils::SetObjectProperty(UObject* Object, const FString& PropertyName, 
+void FEpicUnrealMCPCommonUtils::EnsurePropertyCacheDelegate()
+{
+    if (bPropertyCacheDelegateRegistered || !GEditor)
+    {
+        return;
+    }
+
+    GEditor->OnBlueprintCompiled().AddStatic(&FEpicUnrealMCPCommonUtils::OnBlueprintCompiled);
+    bPropertyCacheDelegateRegistered = true;
+}
+
+void FEpicUnrealMCPCommonUtils::OnBlueprintCompiled()
+{
+    // A recompile rebuilds the FProperty chain inside the same class
+    // object, so every cached pointer for it goes stale at once; dropping
+    // the whole cache is cheap next to the compile itself
+    PropertyLookupCache.Reset();
+}
+
+FProperty* FEpicUnrealMCPCommonUtils::FindCachedProperty(UClass* Class, const FName& PropertyName)
+{
+    EnsurePropertyCacheDelegate();
+
+    const TPair<FObjectKey, FName> CacheKey(FObjectKey(Class), PropertyName);
+    if (FProperty* const* Cached = PropertyLookupCache.Find(CacheKey))
+    {
+        return *Cached;
+    }
+
+    // Only hits are cached: a miss today may resolve tomorrow (e.g. a
+    // property added by a blueprint recompile on a reloaded class)
+    FProperty* Property = Class->FindPropertyByName(PropertyName);
+    if (Property)
+    {
+        PropertyLookupCache.Add(CacheKey, Property);
+    }
+    return Property;
+}
+
+bool FEpicUnrealMCPCommonUtils::SetObjectProperty(UObject* Object, const FString& PropertyName,
                                      const TSharedPtr<FJsonValue>& Value, FString& OutErrorMessage)
 {
     if (!Object)
@@ -551,13 +706,44 @@ bool FEpicUnrealMCPCommonUtils::SetObjectProperty(UObject* Object, const FString
         return false;
     }
 
-    FProperty* Property = Object->GetClass()->FindPropertyByName(*PropertyName);
+    FProperty* Property = FindCachedProperty(Object->GetClass(), FName(*PropertyName));
     if (!Property)
     {
         OutErrorMessage = FString::Printf(TEXT("Property not found: %s"), *PropertyName);
         return false;
     }
 
+    return ApplyPropertyValue(Object, Property, PropertyName, Value, OutErrorMessage);
+}
+
+int32 FEpicUnrealMCPCommonUtils::SetObjectProperties(UObject* Object, const TSharedPtr<FJsonObject>& Properties,
+                                        TArray<FString>& OutErrors)
+{
+    if (!Object)
+    {
+        OutErrors.Add(TEXT("Invalid object"));
+        return 0;
+    }
+
+    int32 SetCount = 0;
+    for (const TPair<FString, TSharedPtr<FJsonValue>>& Field : Properties->Values)
+    {
+        FString ErrorMessage;
+        if (SetObjectProperty(Object, Field.Key, Field.Value, ErrorMessage))
+        {
+            ++SetCount;
+        }
+        else
+        {
+            OutErrors.Add(FString::Printf(TEXT("%s: %s"), *Field.Key, *ErrorMessage));
+        }
+    }
+    return SetCount;
+}
+
+bool FEpicUnrealMCPCommonUtils::ApplyPropertyValue(UObject* Object, FProperty* Property, const FString& PropertyName,
+                                      const TSharedPtr<FJsonValue>& Value, FString& OutErrorMessage)
+{
     void* PropertyAddr = Property->ContainerPtrToValuePtr<void>(Object);
     
     // Handle different property types
@@ -600,7 +786,7 @@ bool FEpicUnrealMCPCommonUtils::SetObjectProperty(UObject* Object, const FString
                 uint8 ByteValue = static_cast<uint8>(Value->AsNumber());
                 ByteProp->SetPropertyValue(PropertyAddr, ByteValue);
                 
-                UE_LOG(LogTemp, Display, TEXT("Setting enum property %s to numeric value: %d"), 
+                MCP_VERBOSE_LOG(TEXT("Setting enum property %s to numeric value: %d"), 
                       *PropertyName, ByteValue);
                 return true;
             }
@@ -615,7 +801,7 @@ bool FEpicUnrealMCPCommonUtils::SetObjectProperty(UObject* Object, const FString
                     uint8 ByteValue = FCString::Atoi(*EnumValueName);
                     ByteProp->SetPropertyValue(PropertyAddr, ByteValue);
                     
-                    UE_LOG(LogTemp, Display, TEXT("Setting enum property %s to numeric string value: %s -> %d"), 
+                    MCP_VERBOSE_LOG(TEXT("Setting enum property %s to numeric string value: %s -> %d"), 
                           *PropertyName, *EnumValueName, ByteValue);
                     return true;
                 }
@@ -637,7 +823,7 @@ bool FEpicUnrealMCPCommonUtils::SetObjectProperty(UObject* Object, const FString
                 {
                     ByteProp->SetPropertyValue(PropertyAddr, static_cast<uint8>(EnumValue));
                     
-                    UE_LOG(LogTemp, Display, TEXT("Setting enum property %s to name value: %s -> %lld"), 
+                    MCP_VERBOSE_LOG(TEXT("Setting enum property %s to name value: %s -> %lld"), 
                           *PropertyName, *EnumValueName, EnumValue);
                     return true;
                 }
@@ -678,7 +864,7 @@ bool FEpicUnrealMCPCommonUtils::SetObjectProperty(UObject* Object, const FString
                 int64 EnumValue = static_cast<int64>(Value->AsNumber());
                 UnderlyingNumericProp->SetIntPropertyValue(PropertyAddr, EnumValue);
                 
-                UE_LOG(LogTemp, Display, TEXT("Setting enum property %s to numeric value: %lld"), 
+                MCP_VERBOSE_LOG(TEXT("Setting enum property %s to numeric value: %lld"), 
                       *PropertyName, EnumValue);
                 return true;
             }
@@ -693,7 +879,7 @@ bool FEpicUnrealMCPCommonUtils::SetObjectProperty(UObject* Object, const FString
                     int64 EnumValue = FCString::Atoi64(*EnumValueName);
                     UnderlyingNumericProp->SetIntPropertyValue(PropertyAddr, EnumValue);
                     
-                    UE_LOG(LogTemp, Display, TEXT("Setting enum property %s to numeric string value: %s -> %lld"), 
+                    MCP_VERBOSE_LOG(TEXT("Setting enum property %s to numeric string value: %s -> %lld"), 
                           *PropertyName, *EnumValueName, EnumValue);
                     return true;
                 }
@@ -715,7 +901,7 @@ bool FEpicUnrealMCPCommonUtils::SetObjectProperty(UObject* Object, const FString
                 {
                     UnderlyingNumericProp->SetIntPropertyValue(PropertyAddr, EnumValue);
                     
-                    UE_LOG(LogTemp, Display, TEXT("Setting enum property %s to name value: %s -> %lld"), 
+                    MCP_VERBOSE_LOG(TEXT("Setting enum property %s to name value: %s -> %lld"), 
                           *PropertyName, *EnumValueName, EnumValue);
                     return true;
                 }
@@ -16,67 +16,236 @@
 #include "Engine/SpotLight.h"
 #include "Camera/CameraActor.h"
 #include "Components/StaticMeshComponent.h"
+#include "Components/HierarchicalInstancedStaticMeshComponent.h"
+#include "Materials/MaterialInterface.h"
 #include "EditorSubsystem.h"
 #include "Subsystems/EditorActorSubsystem.h"
 #include "Engine/Blueprint.h"
 #include "Engine/BlueprintGeneratedClass.h"
 #include "EditorAssetLibrary.h"
+#include "Engine/AssetManager.h"
+#include "Engine/StreamableManager.h"
+#include "ScopedTransaction.h"
+#include "EpicUnrealMCPBridge.h"
+#include "EpicUnrealMCPLog.h"
+#include "EpicUnrealMCPActorIndex.h"
 #include "Commands/EpicUnrealMCPBlueprintCommands.h"
+#include "Serialization/MemoryWriter.h"
 
 FEpicUnrealMCPEditorCommands::FEpicUnrealMCPEditorCommands()
 {
+    // Actor manipulation commands
+    Handlers.Add(TEXT("get_actors_in_level"), [this](const TSharedPtr<FJsonObject>& Params) { return HandleGetActorsInLevel(Params); });
+    Handlers.Add(TEXT("find_actors_by_name"), [this](const TSharedPtr<FJsonObject>& Params) { return HandleFindActorsByName(Params); });
+    Handlers.Add(TEXT("spawn_actor"), [this](const TSharedPtr<FJsonObject>& Params) { return HandleSpawnActor(Params); });
+    Handlers.Add(TEXT("spawn_actors_bulk"), [this](const TSharedPtr<FJsonObject>& Params) { return HandleSpawnActorsBulk(Params); });
+    Handlers.Add(TEXT("spawn_instanced_meshes"), [this](const TSharedPtr<FJsonObject>& Params) { return HandleSpawnInstancedMeshes(Params); });
+    Handlers.Add(TEXT("delete_actor"), [this](const TSharedPtr<FJsonObject>& Params) { return HandleDeleteActor(Params); });
+    Handlers.Add(TEXT("delete_actors_by_pattern"), [this](const TSharedPtr<FJsonObject>& Params) { return HandleDeleteActorsByPattern(Params); });
+    Handlers.Add(TEXT("set_actor_transform"), [this](const TSharedPtr<FJsonObject>& Params) { return HandleSetActorTransform(Params); });
+    Handlers.Add(TEXT("set_actor_transforms_bulk"), [this](const TSharedPtr<FJsonObject>& Params) { return HandleSetActorTransformsBulk(Params); });
+    Handlers.Add(TEXT("preload_assets"), [this](const TSharedPtr<FJsonObject>& Params) { return HandlePreloadAssets(Params); });
+    // spawn_blueprint_actor is owned by FEpicUnrealMCPBlueprintCommands and
+    // registered with the bridge from there
 }
 
 TSharedPtr<FJsonObject> FEpicUnrealMCPEditorCommands::HandleCommand(const FString& CommandType, const TSharedPtr<FJsonObject>& Params)
 {
-    // Actor manipulation commands
-    if (CommandType == TEXT("get_actors_in_level"))
-    {
-        return HandleGetActorsInLevel(Params);
-    }
-    else if (CommandType == TEXT("find_actors_by_name"))
+    if (const FHandlerFunction* Handler = Handlers.Find(FName(*CommandType)))
     {
-        return HandleFindActorsByName(Params);
+        return (*Handler)(Params);
     }
-    else if (CommandType == TEXT("spawn_actor"))
+
+    return FEpicUnrealMCPCommonUtils::CreateErrorResponse(FString::Printf(TEXT("Unknown editor command: %s"), *CommandType));
+}
+
+void FEpicUnrealMCPEditorCommands::RegisterCommands(UEpicUnrealMCPBridge* Bridge)
+{
+    for (const TPair<FName, FHandlerFunction>& Pair : Handlers)
     {
-        return HandleSpawnActor(Params);
+        Bridge->RegisterCommand(Pair.Key, Pair.Value);
     }
-    else if (CommandType == TEXT("delete_actor"))
+}
+
+TSharedPtr<FJsonObject> FEpicUnrealMCPEditorCommands::HandleGetActorsInLevel(const TSharedPtr<FJsonObject>& Params)
+{
+    FEpicUnrealMCPActorIndex& ActorIndex = FEpicUnrealMCPActorIndex::Get();
+
+    // Diff mode: with since_version only actors changed after that baseline
+    // come back, so steady-state polling costs a few bytes instead of the
+    // full list
+    if (Params.IsValid() && Params->HasField(TEXT("since_version")))
     {
-        return HandleDeleteActor(Params);
+        const uint64 SinceVersion = (uint64)Params->GetNumberField(TEXT("since_version"));
+
+        TArray<AActor*> Added;
+        TArray<AActor*> Modified;
+        TArray<FName> RemovedNames;
+        if (ActorIndex.GetChangesSince(GWorld, SinceVersion, Added, Modified, RemovedNames))
+        {
+            TArray<TSharedPtr<FJsonValue>> AddedArray;
+            for (AActor* Actor : Added)
+            {
+                AddedArray.Add(FEpicUnrealMCPCommonUtils::ActorToJson(Actor));
+            }
+
+            TArray<TSharedPtr<FJsonValue>> ModifiedArray;
+            for (AActor* Actor : Modified)
+            {
+                ModifiedArray.Add(FEpicUnrealMCPCommonUtils::ActorToJson(Actor));
+            }
+
+            TArray<TSharedPtr<FJsonValue>> RemovedArray;
+            for (const FName& Name : RemovedNames)
+            {
+                RemovedArray.Add(MakeShared<FJsonValueString>(Name.ToString()));
+            }
+
+            TSharedPtr<FJsonObject> DiffObj = MakeShared<FJsonObject>();
+            DiffObj->SetBoolField(TEXT("full"), false);
+            DiffObj->SetNumberField(TEXT("scene_version"), (double)ActorIndex.GetSceneVersion(GWorld));
+            DiffObj->SetArrayField(TEXT("added"), AddedArray);
+            DiffObj->SetArrayField(TEXT("modified"), ModifiedArray);
+            DiffObj->SetArrayField(TEXT("removed"), RemovedArray);
+            return DiffObj;
+        }
+        // Baseline too old or from another world: fall through to a full
+        // snapshot tagged with the current version
     }
-    else if (CommandType == TEXT("set_actor_transform"))
+
+    // Full snapshots honor the optional region filter; diffs above are
+    // already proportional to the change set and stay world-wide
+    TArray<AActor*> AllActors;
+    if (!CollectRegionActors(Params, AllActors))
     {
-        return HandleSetActorTransform(Params);
+        UGameplayStatics::GetAllActorsOfClass(GWorld, AActor::StaticClass(), AllActors);
     }
-    // Blueprint actor spawning
-    else if (CommandType == TEXT("spawn_blueprint_actor"))
+
+    TArray<TSharedPtr<FJsonValue>> ActorArray;
+    for (AActor* Actor : AllActors)
     {
-        return HandleSpawnBlueprintActor(Params);
+        if (Actor)
+        {
+            ActorArray.Add(FEpicUnrealMCPCommonUtils::ActorToJson(Actor));
+        }
     }
-    
-    return FEpicUnrealMCPCommonUtils::CreateErrorResponse(FString::Printf(TEXT("Unknown editor command: %s"), *CommandType));
+
+    TSharedPtr<FJsonObject> ResultObj = MakeShared<FJsonObject>();
+    ResultObj->SetBoolField(TEXT("full"), true);
+    ResultObj->SetNumberField(TEXT("scene_version"), (double)ActorIndex.GetSceneVersion(GWorld));
+    ResultObj->SetArrayField(TEXT("actors"), ActorArray);
+
+    return ResultObj;
 }
 
-TSharedPtr<FJsonObject> FEpicUnrealMCPEditorCommands::HandleGetActorsInLevel(const TSharedPtr<FJsonObject>& Params)
+void FEpicUnrealMCPEditorCommands::SnapshotActorsInLevel(TArray<FMCPActorSnapshot>& OutSnapshots)
 {
     TArray<AActor*> AllActors;
     UGameplayStatics::GetAllActorsOfClass(GWorld, AActor::StaticClass(), AllActors);
-    
-    TArray<TSharedPtr<FJsonValue>> ActorArray;
+
+    OutSnapshots.Reserve(AllActors.Num());
     for (AActor* Actor : AllActors)
     {
         if (Actor)
         {
-            ActorArray.Add(FEpicUnrealMCPCommonUtils::ActorToJson(Actor));
+            OutSnapshots.Add(FEpicUnrealMCPCommonUtils::SnapshotActor(Actor));
         }
     }
-    
+}
+
+void FEpicUnrealMCPEditorCommands::SnapshotActorsMatchingPattern(const FString& Pattern, TArray<FMCPActorSnapshot>& OutSnapshots)
+{
+    TArray<AActor*> MatchedActors;
+    FEpicUnrealMCPActorIndex::Get().GetActorsMatchingPattern(GWorld, Pattern, MatchedActors);
+
+    OutSnapshots.Reserve(MatchedActors.Num());
+    for (AActor* Actor : MatchedActors)
+    {
+        OutSnapshots.Add(FEpicUnrealMCPCommonUtils::SnapshotActor(Actor));
+    }
+}
+
+void FEpicUnrealMCPEditorCommands::StreamActorsInLevel(const TSharedPtr<FJsonObject>& Params, const TSharedPtr<FJsonValue>& RequestId, const TFunction<void(const TArray<uint8>&)>& ChunkSink)
+{
+    // Actors per chunk bounds both the frame size on the wire and the JSON
+    // held in memory at any one time
+    const int32 ActorsPerChunk = 250;
+
+    TArray<AActor*> AllActors;
+    UGameplayStatics::GetAllActorsOfClass(GWorld, AActor::StaticClass(), AllActors);
+
+    int32 TotalActors = 0;
+    int32 ChunkCount = 0;
+    int32 ActorIndex = 0;
+
+    // Each chunk is written straight into the reused byte buffer - no DOM,
+    // and after the first chunk no buffer growth either
+    TArray<uint8> ChunkBytes;
+    while (ActorIndex < AllActors.Num())
+    {
+        ChunkBytes.Reset();
+        FMemoryWriter MemoryWriter(ChunkBytes);
+        TSharedRef<TJsonWriter<UTF8CHAR>> Writer = TJsonWriter<UTF8CHAR>::Create(&MemoryWriter);
+
+        Writer->WriteObjectStart();
+        Writer->WriteValue(TEXT("status"), TEXT("chunk"));
+        Writer->WriteValue(TEXT("chunk_index"), ChunkCount);
+        if (RequestId.IsValid())
+        {
+            if (RequestId->Type == EJson::Number)
+            {
+                Writer->WriteValue(TEXT("id"), RequestId->AsNumber());
+            }
+            else
+            {
+                Writer->WriteValue(TEXT("id"), RequestId->AsString());
+            }
+        }
+        Writer->WriteArrayStart(TEXT("actors"));
+
+        int32 ActorsThisChunk = 0;
+        while (ActorIndex < AllActors.Num() && ActorsThisChunk < ActorsPerChunk)
+        {
+            AActor* Actor = AllActors[ActorIndex++];
+            if (!Actor)
+            {
+                continue;
+            }
+
+            FEpicUnrealMCPCommonUtils::WriteActorJson(*Writer, Actor);
+            ++ActorsThisChunk;
+        }
+
+        Writer->WriteArrayEnd();
+        Writer->WriteObjectEnd();
+        Writer->Close();
+
+        if (ActorsThisChunk > 0)
+        {
+            ChunkSink(ChunkBytes);
+            TotalActors += ActorsThisChunk;
+            ++ChunkCount;
+        }
+    }
+
+    // Final envelope carries only the totals - the actors already went out
+    // in the chunk frames above
     TSharedPtr<FJsonObject> ResultObj = MakeShared<FJsonObject>();
-    ResultObj->SetArrayField(TEXT("actors"), ActorArray);
-    
-    return ResultObj;
+    ResultObj->SetBoolField(TEXT("streamed"), true);
+    ResultObj->SetNumberField(TEXT("actor_count"), TotalActors);
+    ResultObj->SetNumberField(TEXT("chunk_count"), ChunkCount);
+
+    TSharedPtr<FJsonObject> ResponseJson = MakeShared<FJsonObject>();
+    ResponseJson->SetStringField(TEXT("status"), TEXT("success"));
+    ResponseJson->SetObjectField(TEXT("result"), ResultObj);
+    if (RequestId.IsValid())
+    {
+        ResponseJson->SetField(TEXT("id"), RequestId);
+    }
+
+    TArray<uint8> FinalBytes;
+    FEpicUnrealMCPCommonUtils::SerializeJsonToUtf8(ResponseJson.ToSharedRef(), FinalBytes);
+    ChunkSink(FinalBytes);
 }
 
 TSharedPtr<FJsonObject> FEpicUnrealMCPEditorCommands::HandleFindActorsByName(const TSharedPtr<FJsonObject>& Params)
@@ -87,24 +256,109 @@ TSharedPtr<FJsonObject> FEpicUnrealMCPEditorCommands::HandleFindActorsByName(con
         return FEpicUnrealMCPCommonUtils::CreateErrorResponse(TEXT("Missing 'pattern' parameter"));
     }
     
-    TArray<AActor*> AllActors;
-    UGameplayStatics::GetAllActorsOfClass(GWorld, AActor::StaticClass(), AllActors);
-    
-    TArray<TSharedPtr<FJsonValue>> MatchingActors;
-    for (AActor* Actor : AllActors)
+    TArray<AActor*> MatchedActors;
+    TArray<AActor*> RegionActors;
+    if (CollectRegionActors(Params, RegionActors))
     {
-        if (Actor && Actor->GetName().Contains(Pattern))
+        // Region first, then the name test - the region is the small set
+        for (AActor* Actor : RegionActors)
         {
-            MatchingActors.Add(FEpicUnrealMCPCommonUtils::ActorToJson(Actor));
+            if (Actor->GetFName().ToString().Contains(Pattern))
+            {
+                MatchedActors.Add(Actor);
+            }
         }
     }
-    
+    else
+    {
+        FEpicUnrealMCPActorIndex::Get().GetActorsMatchingPattern(GWorld, Pattern, MatchedActors);
+    }
+
+    TArray<TSharedPtr<FJsonValue>> MatchingActors;
+    for (AActor* Actor : MatchedActors)
+    {
+        MatchingActors.Add(FEpicUnrealMCPCommonUtils::ActorToJson(Actor));
+    }
+
     TSharedPtr<FJsonObject> ResultObj = MakeShared<FJsonObject>();
     ResultObj->SetArrayField(TEXT("actors"), MatchingActors);
-    
+
     return ResultObj;
 }
 
+bool FEpicUnrealMCPEditorCommands::HasRegionFilter(const TSharedPtr<FJsonObject>& Params)
+{
+    return Params.IsValid()
+        && (Params->HasField(TEXT("sublevel")) || Params->HasField(TEXT("bounds_min")));
+}
+
+bool FEpicUnrealMCPEditorCommands::CollectRegionActors(const TSharedPtr<FJsonObject>& Params, TArray<AActor*>& OutActors)
+{
+    if (!Params.IsValid())
+    {
+        return false;
+    }
+
+    FEpicUnrealMCPActorIndex& ActorIndex = FEpicUnrealMCPActorIndex::Get();
+
+    const bool bHasBounds = Params->HasField(TEXT("bounds_min")) && Params->HasField(TEXT("bounds_max"));
+    FBox Bounds(ForceInit);
+    if (bHasBounds)
+    {
+        Bounds = FBox(
+            FEpicUnrealMCPCommonUtils::GetVectorFromJson(Params, TEXT("bounds_min")),
+            FEpicUnrealMCPCommonUtils::GetVectorFromJson(Params, TEXT("bounds_max")));
+    }
+
+    FString Sublevel;
+    if (Params->TryGetStringField(TEXT("sublevel"), Sublevel))
+    {
+        ActorIndex.GetActorsInSublevel(GWorld, FName(*Sublevel), OutActors);
+        if (bHasBounds)
+        {
+            OutActors.RemoveAll([&Bounds](AActor* Actor)
+            {
+                return !Bounds.IsInsideOrOn(Actor->GetActorLocation());
+            });
+        }
+        return true;
+    }
+
+    if (bHasBounds)
+    {
+        ActorIndex.GetActorsInBounds(GWorld, Bounds, OutActors);
+        return true;
+    }
+
+    return false;
+}
+
+UClass* FEpicUnrealMCPEditorCommands::ResolveActorTypeClass(const FString& ActorType)
+{
+    if (ActorType == TEXT("StaticMeshActor"))
+    {
+        return AStaticMeshActor::StaticClass();
+    }
+    else if (ActorType == TEXT("PointLight"))
+    {
+        return APointLight::StaticClass();
+    }
+    else if (ActorType == TEXT("SpotLight"))
+    {
+        return ASpotLight::StaticClass();
+    }
+    else if (ActorType == TEXT("DirectionalLight"))
+    {
+        return ADirectionalLight::StaticClass();
+    }
+    else if (ActorType == TEXT("CameraActor"))
+    {
+        return ACameraActor::StaticClass();
+    }
+
+    return nullptr;
+}
+
 TSharedPtr<FJsonObject> FEpicUnrealMCPEditorCommands::HandleSpawnActor(const TSharedPtr<FJsonObject>& Params)
 {
     // Get required parameters
@@ -148,78 +402,198 @@ TSharedPtr<FJsonObject> FEpicUnrealMCPEditorCommands::HandleSpawnActor(const TSh
         return FEpicUnrealMCPCommonUtils::CreateErrorResponse(TEXT("Failed to get editor world"));
     }
 
-    // Check if an actor with this name already exists
-    TArray<AActor*> AllActors;
-    UGameplayStatics::GetAllActorsOfClass(World, AActor::StaticClass(), AllActors);
-    for (AActor* Actor : AllActors)
+    // With auto_unique the server suffixes a taken name instead of failing;
+    // the response carries the final name either way
+    bool bAutoUnique = false;
+    Params->TryGetBoolField(TEXT("auto_unique"), bAutoUnique);
+
+    if (bAutoUnique)
     {
-        if (Actor && Actor->GetName() == ActorName)
-        {
-            return FEpicUnrealMCPCommonUtils::CreateErrorResponse(FString::Printf(TEXT("Actor with name '%s' already exists"), *ActorName));
-        }
+        ActorName = FEpicUnrealMCPActorIndex::Get().MakeUniqueName(World, ActorName);
+    }
+    else if (FEpicUnrealMCPActorIndex::Get().ContainsName(World, ActorName))
+    {
+        return FEpicUnrealMCPCommonUtils::CreateErrorResponse(FString::Printf(TEXT("Actor with name '%s' already exists"), *ActorName));
+    }
+
+    UClass* ActorClass = ResolveActorTypeClass(ActorType);
+    if (!ActorClass)
+    {
+        return FEpicUnrealMCPCommonUtils::CreateErrorResponse(FString::Printf(TEXT("Unknown actor type: %s"), *ActorType));
     }
 
     FActorSpawnParameters SpawnParams;
     SpawnParams.Name = *ActorName;
 
-    if (ActorType == TEXT("StaticMeshActor"))
+    NewActor = World->SpawnActor<AActor>(ActorClass, Location, Rotation, SpawnParams);
+
+    if (AStaticMeshActor* NewMeshActor = Cast<AStaticMeshActor>(NewActor))
     {
-        AStaticMeshActor* NewMeshActor = World->SpawnActor<AStaticMeshActor>(AStaticMeshActor::StaticClass(), Location, Rotation, SpawnParams);
-        if (NewMeshActor)
+        // Check for an optional static_mesh parameter to assign a mesh
+        FString MeshPath;
+        if (Params->TryGetStringField(TEXT("static_mesh"), MeshPath))
         {
-            // Check for an optional static_mesh parameter to assign a mesh
-            FString MeshPath;
-            if (Params->TryGetStringField(TEXT("static_mesh"), MeshPath))
+            UStaticMesh* Mesh = Cast<UStaticMesh>(UEditorAssetLibrary::LoadAsset(MeshPath));
+            if (Mesh)
             {
-                UStaticMesh* Mesh = Cast<UStaticMesh>(UEditorAssetLibrary::LoadAsset(MeshPath));
-                if (Mesh)
-                {
-                    NewMeshActor->GetStaticMeshComponent()->SetStaticMesh(Mesh);
-                }
-                else
-                {
-                    UE_LOG(LogTemp, Warning, TEXT("Could not find static mesh at path: %s"), *MeshPath);
-                }
+                NewMeshActor->GetStaticMeshComponent()->SetStaticMesh(Mesh);
+            }
+            else
+            {
+                UE_LOG(LogTemp, Warning, TEXT("Could not find static mesh at path: %s"), *MeshPath);
             }
         }
-        NewActor = NewMeshActor;
     }
-    else if (ActorType == TEXT("PointLight"))
+
+    if (NewActor)
     {
-        NewActor = World->SpawnActor<APointLight>(APointLight::StaticClass(), Location, Rotation, SpawnParams);
+        // Set scale (since SpawnActor only takes location and rotation)
+        FTransform Transform = NewActor->GetTransform();
+        Transform.SetScale3D(Scale);
+        NewActor->SetActorTransform(Transform);
+
+        // Return the created actor's details
+        return FEpicUnrealMCPCommonUtils::ActorToJsonObject(NewActor, true);
     }
-    else if (ActorType == TEXT("SpotLight"))
+
+    return FEpicUnrealMCPCommonUtils::CreateErrorResponse(TEXT("Failed to create actor"));
+}
+
+TSharedPtr<FJsonObject> FEpicUnrealMCPEditorCommands::HandleSpawnActorsBulk(const TSharedPtr<FJsonObject>& Params)
+{
+    // Get the shared actor type for the whole batch
+    FString ActorType;
+    if (!Params->TryGetStringField(TEXT("type"), ActorType))
     {
-        NewActor = World->SpawnActor<ASpotLight>(ASpotLight::StaticClass(), Location, Rotation, SpawnParams);
+        return FEpicUnrealMCPCommonUtils::CreateErrorResponse(TEXT("Missing 'type' parameter"));
     }
-    else if (ActorType == TEXT("DirectionalLight"))
+
+    const TArray<TSharedPtr<FJsonValue>>* ActorEntries;
+    if (!Params->TryGetArrayField(TEXT("actors"), ActorEntries))
     {
-        NewActor = World->SpawnActor<ADirectionalLight>(ADirectionalLight::StaticClass(), Location, Rotation, SpawnParams);
+        return FEpicUnrealMCPCommonUtils::CreateErrorResponse(TEXT("Missing 'actors' array parameter"));
     }
-    else if (ActorType == TEXT("CameraActor"))
+
+    // Resolve the class once for the whole batch
+    UClass* ActorClass = ResolveActorTypeClass(ActorType);
+    if (!ActorClass)
     {
-        NewActor = World->SpawnActor<ACameraActor>(ACameraActor::StaticClass(), Location, Rotation, SpawnParams);
+        return FEpicUnrealMCPCommonUtils::CreateErrorResponse(FString::Printf(TEXT("Unknown actor type: %s"), *ActorType));
     }
-    else
+
+    UWorld* World = GEditor->GetEditorWorldContext().World();
+    if (!World)
     {
-        return FEpicUnrealMCPCommonUtils::CreateErrorResponse(FString::Printf(TEXT("Unknown actor type: %s"), *ActorType));
+        return FEpicUnrealMCPCommonUtils::CreateErrorResponse(TEXT("Failed to get editor world"));
     }
 
-    if (NewActor)
+    // Load the optional shared mesh once instead of per actor
+    UStaticMesh* SharedMesh = nullptr;
+    FString MeshPath;
+    if (Params->TryGetStringField(TEXT("static_mesh"), MeshPath))
+    {
+        SharedMesh = Cast<UStaticMesh>(UEditorAssetLibrary::LoadAsset(MeshPath));
+        if (!SharedMesh)
+        {
+            UE_LOG(LogTemp, Warning, TEXT("Could not find static mesh at path: %s"), *MeshPath);
+        }
+    }
+
+    // Name-collision checks go through the persistent actor index; spawned
+    // actors are added to it via the editor's OnLevelActorAdded delegate
+    FEpicUnrealMCPActorIndex& ActorIndex = FEpicUnrealMCPActorIndex::Get();
+
+    // Batch-wide auto_unique: taken names get a suffix instead of an error
+    bool bAutoUnique = false;
+    Params->TryGetBoolField(TEXT("auto_unique"), bAutoUnique);
+
+    // Spawn all actors inside one editor transaction
+    FScopedTransaction Transaction(FText::FromString(TEXT("MCP Bulk Spawn Actors")));
+
+    TArray<TSharedPtr<FJsonValue>> SpawnedActors;
+    TArray<TSharedPtr<FJsonValue>> Errors;
+    SpawnedActors.Reserve(ActorEntries->Num());
+
+    for (int32 EntryIndex = 0; EntryIndex < ActorEntries->Num(); ++EntryIndex)
     {
+        const TSharedPtr<FJsonObject>* Entry;
+        if (!(*ActorEntries)[EntryIndex].IsValid() || !(*ActorEntries)[EntryIndex]->TryGetObject(Entry))
+        {
+            Errors.Add(MakeShared<FJsonValueString>(FString::Printf(TEXT("Entry %d is not an object"), EntryIndex)));
+            continue;
+        }
+
+        FString ActorName;
+        if (!(*Entry)->TryGetStringField(TEXT("name"), ActorName))
+        {
+            Errors.Add(MakeShared<FJsonValueString>(FString::Printf(TEXT("Entry %d missing 'name'"), EntryIndex)));
+            continue;
+        }
+
+        if (bAutoUnique)
+        {
+            ActorName = ActorIndex.MakeUniqueName(World, ActorName);
+        }
+        else if (ActorIndex.ContainsName(World, ActorName))
+        {
+            Errors.Add(MakeShared<FJsonValueString>(FString::Printf(TEXT("Actor with name '%s' already exists"), *ActorName)));
+            continue;
+        }
+
+        FVector Location(0.0f, 0.0f, 0.0f);
+        FRotator Rotation(0.0f, 0.0f, 0.0f);
+        FVector Scale(1.0f, 1.0f, 1.0f);
+
+        if ((*Entry)->HasField(TEXT("location")))
+        {
+            Location = FEpicUnrealMCPCommonUtils::GetVectorFromJson(*Entry, TEXT("location"));
+        }
+        if ((*Entry)->HasField(TEXT("rotation")))
+        {
+            Rotation = FEpicUnrealMCPCommonUtils::GetRotatorFromJson(*Entry, TEXT("rotation"));
+        }
+        if ((*Entry)->HasField(TEXT("scale")))
+        {
+            Scale = FEpicUnrealMCPCommonUtils::GetVectorFromJson(*Entry, TEXT("scale"));
+        }
+
+        FActorSpawnParameters SpawnParams;
+        SpawnParams.Name = *ActorName;
+
+        AActor* NewActor = World->SpawnActor<AActor>(ActorClass, Location, Rotation, SpawnParams);
+        if (!NewActor)
+        {
+            Errors.Add(MakeShared<FJsonValueString>(FString::Printf(TEXT("Failed to spawn actor '%s'"), *ActorName)));
+            continue;
+        }
+
+        if (SharedMesh)
+        {
+            if (AStaticMeshActor* MeshActor = Cast<AStaticMeshActor>(NewActor))
+            {
+                MeshActor->GetStaticMeshComponent()->SetStaticMesh(SharedMesh);
+            }
+        }
+
         // Set scale (since SpawnActor only takes location and rotation)
         FTransform Transform = NewActor->GetTransform();
         Transform.SetScale3D(Scale);
         NewActor->SetActorTransform(Transform);
 
-        // Return the created actor's details
-        return FEpicUnrealMCPCommonUtils::ActorToJsonObject(NewActor, true);
+        SpawnedActors.Add(FEpicUnrealMCPCommonUtils::ActorToJson(NewActor));
     }
 
-    return FEpicUnrealMCPCommonUtils::CreateErrorResponse(TEXT("Failed to create actor"));
+    TSharedPtr<FJsonObject> ResultObj = MakeShared<FJsonObject>();
+    ResultObj->SetArrayField(TEXT("actors"), SpawnedActors);
+    ResultObj->SetNumberField(TEXT("spawned_count"), SpawnedActors.Num());
+    if (Errors.Num() > 0)
+    {
+        ResultObj->SetArrayField(TEXT("errors"), Errors);
+    }
+    return ResultObj;
 }
 
-TSharedPtr<FJsonObject> FEpicUnrealMCPEditorCommands::HandleDeleteActor(const TSharedPtr<FJsonObject>& Params)
+TSharedPtr<FJsonObject> FEpicUnrealMCPEditorCommands::HandleSpawnInstancedMeshes(const TSharedPtr<FJsonObject>& Params)
 {
     FString ActorName;
     if (!Params->TryGetStringField(TEXT("name"), ActorName))
@@ -227,51 +601,245 @@ TSharedPtr<FJsonObject> FEpicUnrealMCPEditorCommands::HandleDeleteActor(const TS
         return FEpicUnrealMCPCommonUtils::CreateErrorResponse(TEXT("Missing 'name' parameter"));
     }
 
-    TArray<AActor*> AllActors;
-    UGameplayStatics::GetAllActorsOfClass(GWorld, AActor::StaticClass(), AllActors);
-    
-    for (AActor* Actor : AllActors)
+    // One array entry per mesh/material combo, each with its own transforms
+    const TArray<TSharedPtr<FJsonValue>>* MeshEntries;
+    if (!Params->TryGetArrayField(TEXT("meshes"), MeshEntries))
+    {
+        return FEpicUnrealMCPCommonUtils::CreateErrorResponse(TEXT("Missing 'meshes' array parameter"));
+    }
+
+    UWorld* World = GEditor->GetEditorWorldContext().World();
+    if (!World)
+    {
+        return FEpicUnrealMCPCommonUtils::CreateErrorResponse(TEXT("Failed to get editor world"));
+    }
+
+    FEpicUnrealMCPActorIndex& ActorIndex = FEpicUnrealMCPActorIndex::Get();
+
+    bool bAutoUnique = false;
+    Params->TryGetBoolField(TEXT("auto_unique"), bAutoUnique);
+
+    if (bAutoUnique)
+    {
+        ActorName = ActorIndex.MakeUniqueName(World, ActorName);
+    }
+    else if (ActorIndex.ContainsName(World, ActorName))
+    {
+        return FEpicUnrealMCPCommonUtils::CreateErrorResponse(FString::Printf(TEXT("Actor with name '%s' already exists"), *ActorName));
+    }
+
+    FVector Location(0.0f, 0.0f, 0.0f);
+    if (Params->HasField(TEXT("location")))
+    {
+        Location = FEpicUnrealMCPCommonUtils::GetVectorFromJson(Params, TEXT("location"));
+    }
+
+    FScopedTransaction Transaction(FText::FromString(TEXT("MCP Spawn Instanced Meshes")));
+
+    FActorSpawnParameters SpawnParams;
+    SpawnParams.Name = *ActorName;
+
+    // One container actor holds every instanced component; a 20k-piece
+    // structure becomes a handful of components instead of 20k actors
+    AActor* Container = World->SpawnActor<AActor>(AActor::StaticClass(), Location, FRotator::ZeroRotator, SpawnParams);
+    if (!Container)
     {
-        if (Actor && Actor->GetName() == ActorName)
+        return FEpicUnrealMCPCommonUtils::CreateErrorResponse(TEXT("Failed to spawn container actor"));
+    }
+
+    USceneComponent* Root = NewObject<USceneComponent>(Container, TEXT("Root"));
+    Container->SetRootComponent(Root);
+    Container->AddInstanceComponent(Root);
+    Root->SetWorldLocation(Location);
+    Root->RegisterComponent();
+
+    TArray<TSharedPtr<FJsonValue>> ComponentResults;
+    TArray<TSharedPtr<FJsonValue>> Errors;
+    int32 TotalInstances = 0;
+
+    for (int32 EntryIndex = 0; EntryIndex < MeshEntries->Num(); ++EntryIndex)
+    {
+        const TSharedPtr<FJsonObject>* Entry;
+        if (!(*MeshEntries)[EntryIndex].IsValid() || !(*MeshEntries)[EntryIndex]->TryGetObject(Entry))
+        {
+            Errors.Add(MakeShared<FJsonValueString>(FString::Printf(TEXT("Entry %d is not an object"), EntryIndex)));
+            continue;
+        }
+
+        FString MeshPath;
+        if (!(*Entry)->TryGetStringField(TEXT("static_mesh"), MeshPath))
+        {
+            Errors.Add(MakeShared<FJsonValueString>(FString::Printf(TEXT("Entry %d missing 'static_mesh'"), EntryIndex)));
+            continue;
+        }
+
+        UStaticMesh* Mesh = Cast<UStaticMesh>(UEditorAssetLibrary::LoadAsset(MeshPath));
+        if (!Mesh)
+        {
+            Errors.Add(MakeShared<FJsonValueString>(FString::Printf(TEXT("Could not find static mesh at path: %s"), *MeshPath)));
+            continue;
+        }
+
+        const TArray<TSharedPtr<FJsonValue>>* TransformEntries;
+        if (!(*Entry)->TryGetArrayField(TEXT("transforms"), TransformEntries))
         {
-            // Store actor info before deletion for the response
-            TSharedPtr<FJsonObject> ActorInfo = FEpicUnrealMCPCommonUtils::ActorToJsonObject(Actor);
-            
-            // Delete the actor
-            Actor->Destroy();
-            
-            TSharedPtr<FJsonObject> ResultObj = MakeShared<FJsonObject>();
-            ResultObj->SetObjectField(TEXT("deleted_actor"), ActorInfo);
-            return ResultObj;
+            Errors.Add(MakeShared<FJsonValueString>(FString::Printf(TEXT("Entry %d missing 'transforms' array"), EntryIndex)));
+            continue;
+        }
+
+        UHierarchicalInstancedStaticMeshComponent* InstancedComponent = NewObject<UHierarchicalInstancedStaticMeshComponent>(Container);
+        InstancedComponent->SetupAttachment(Root);
+        Container->AddInstanceComponent(InstancedComponent);
+        InstancedComponent->SetStaticMesh(Mesh);
+
+        FString MaterialPath;
+        if ((*Entry)->TryGetStringField(TEXT("material"), MaterialPath))
+        {
+            UMaterialInterface* Material = Cast<UMaterialInterface>(UEditorAssetLibrary::LoadAsset(MaterialPath));
+            if (Material)
+            {
+                InstancedComponent->SetMaterial(0, Material);
+            }
+            else
+            {
+                Errors.Add(MakeShared<FJsonValueString>(FString::Printf(TEXT("Could not find material at path: %s"), *MaterialPath)));
+            }
+        }
+
+        InstancedComponent->RegisterComponent();
+        InstancedComponent->PreAllocateInstancesMemory(TransformEntries->Num());
+
+        // Transforms are relative to the container actor
+        int32 InstanceCount = 0;
+        for (const TSharedPtr<FJsonValue>& TransformValue : *TransformEntries)
+        {
+            const TSharedPtr<FJsonObject>* TransformObject;
+            if (!TransformValue.IsValid() || !TransformValue->TryGetObject(TransformObject))
+            {
+                continue;
+            }
+
+            FVector InstanceLocation(0.0f, 0.0f, 0.0f);
+            FRotator InstanceRotation(0.0f, 0.0f, 0.0f);
+            FVector InstanceScale(1.0f, 1.0f, 1.0f);
+
+            if ((*TransformObject)->HasField(TEXT("location")))
+            {
+                InstanceLocation = FEpicUnrealMCPCommonUtils::GetVectorFromJson(*TransformObject, TEXT("location"));
+            }
+            if ((*TransformObject)->HasField(TEXT("rotation")))
+            {
+                InstanceRotation = FEpicUnrealMCPCommonUtils::GetRotatorFromJson(*TransformObject, TEXT("rotation"));
+            }
+            if ((*TransformObject)->HasField(TEXT("scale")))
+            {
+                InstanceScale = FEpicUnrealMCPCommonUtils::GetVectorFromJson(*TransformObject, TEXT("scale"));
+            }
+
+            InstancedComponent->AddInstance(FTransform(InstanceRotation, InstanceLocation, InstanceScale));
+            ++InstanceCount;
         }
+
+        TotalInstances += InstanceCount;
+
+        TSharedPtr<FJsonObject> ComponentResult = MakeShared<FJsonObject>();
+        ComponentResult->SetStringField(TEXT("static_mesh"), MeshPath);
+        ComponentResult->SetNumberField(TEXT("instance_count"), InstanceCount);
+        ComponentResults.Add(MakeShared<FJsonValueObject>(ComponentResult));
     }
-    
-    return FEpicUnrealMCPCommonUtils::CreateErrorResponse(FString::Printf(TEXT("Actor not found: %s"), *ActorName));
+
+    TSharedPtr<FJsonObject> ResultObj = MakeShared<FJsonObject>();
+    ResultObj->SetStringField(TEXT("name"), Container->GetName());
+    ResultObj->SetArrayField(TEXT("components"), ComponentResults);
+    ResultObj->SetNumberField(TEXT("total_instances"), TotalInstances);
+    if (Errors.Num() > 0)
+    {
+        ResultObj->SetArrayField(TEXT("errors"), Errors);
+    }
+    return ResultObj;
 }
 
-TSharedPtr<FJsonObject> FEpicUnrealMCPEditorCommands::HandleSetActorTransform(const TSharedPtr<FJsonObject>& Params)
+TSharedPtr<FJsonObject> FEpicUnrealMCPEditorCommands::HandleDeleteActor(const TSharedPtr<FJsonObject>& Params)
 {
-    // Get actor name
     FString ActorName;
     if (!Params->TryGetStringField(TEXT("name"), ActorName))
     {
         return FEpicUnrealMCPCommonUtils::CreateErrorResponse(TEXT("Missing 'name' parameter"));
     }
 
-    // Find the actor
-    AActor* TargetActor = nullptr;
-    TArray<AActor*> AllActors;
-    UGameplayStatics::GetAllActorsOfClass(GWorld, AActor::StaticClass(), AllActors);
-    
-    for (AActor* Actor : AllActors)
+    AActor* Actor = FEpicUnrealMCPActorIndex::Get().FindActorByName(GWorld, ActorName);
+    if (!Actor)
     {
-        if (Actor && Actor->GetName() == ActorName)
+        return FEpicUnrealMCPCommonUtils::CreateErrorResponse(FString::Printf(TEXT("Actor not found: %s"), *ActorName));
+    }
+
+    // Store actor info before deletion for the response
+    TSharedPtr<FJsonObject> ActorInfo = FEpicUnrealMCPCommonUtils::ActorToJsonObject(Actor);
+
+    // Delete the actor (the index drops it via OnLevelActorDeleted)
+    Actor->Destroy();
+
+    TSharedPtr<FJsonObject> ResultObj = MakeShared<FJsonObject>();
+    ResultObj->SetObjectField(TEXT("deleted_actor"), ActorInfo);
+    return ResultObj;
+}
+
+TSharedPtr<FJsonObject> FEpicUnrealMCPEditorCommands::HandleDeleteActorsByPattern(const TSharedPtr<FJsonObject>& Params)
+{
+    FString Pattern;
+    if (!Params->TryGetStringField(TEXT("pattern"), Pattern) || Pattern.IsEmpty())
+    {
+        return FEpicUnrealMCPCommonUtils::CreateErrorResponse(TEXT("Missing 'pattern' parameter"));
+    }
+
+    // Match against the actor index - one hash map walk instead of one full
+    // level scan per deleted actor
+    TArray<AActor*> MatchedActors;
+    FEpicUnrealMCPActorIndex::Get().GetActorsMatchingPattern(GWorld, Pattern, MatchedActors);
+
+    TArray<TSharedPtr<FJsonValue>> DeletedNames;
+    DeletedNames.Reserve(MatchedActors.Num());
+
+    if (MatchedActors.Num() > 0)
+    {
+        // One transaction covering the whole teardown, so undo restores the
+        // generated content in a single step
+        FScopedTransaction Transaction(FText::FromString(TEXT("MCP Delete Actors By Pattern")));
+
+        for (AActor* Actor : MatchedActors)
         {
-            TargetActor = Actor;
-            break;
+            const FString ActorName = Actor->GetName();
+            Actor->Modify();
+            if (Actor->Destroy())
+            {
+                DeletedNames.Add(MakeShared<FJsonValueString>(ActorName));
+            }
         }
+
+        if (GEditor && !UEpicUnrealMCPBridge::IsBulkEditActive())
+        {
+            GEditor->RedrawLevelEditingViewports();
+        }
+    }
+
+    TSharedPtr<FJsonObject> ResultObj = MakeShared<FJsonObject>();
+    ResultObj->SetNumberField(TEXT("deleted_count"), DeletedNames.Num());
+    ResultObj->SetArrayField(TEXT("deleted_actors"), DeletedNames);
+    return ResultObj;
+}
+
+TSharedPtr<FJsonObject> FEpicUnrealMCPEditorCommands::HandleSetActorTransform(const TSharedPtr<FJsonObject>& Params)
+{
+    // Get actor name
+    FString ActorName;
+    if (!Params->TryGetStringField(TEXT("name"), ActorName))
+    {
+        return FEpicUnrealMCPCommonUtils::CreateErrorResponse(TEXT("Missing 'name' parameter"));
     }
 
+    // Find the actor
+    AActor* TargetActor = FEpicUnrealMCPActorIndex::Get().FindActorByName(GWorld, ActorName);
+
     if (!TargetActor)
     {
         return FEpicUnrealMCPCommonUtils::CreateErrorResponse(FString::Printf(TEXT("Actor not found: %s"), *ActorName));
@@ -296,13 +864,168 @@ TSharedPtr<FJsonObject> FEpicUnrealMCPEditorCommands::HandleSetActorTransform(co
     // Set the new transform
     TargetActor->SetActorTransform(NewTransform);
 
+    // Programmatic moves don't fire OnActorMoved, so bump the scene version
+    // by hand for incremental diff clients
+    FEpicUnrealMCPActorIndex::Get().NotifyActorModified(TargetActor);
+
     // Return updated actor info
     return FEpicUnrealMCPCommonUtils::ActorToJsonObject(TargetActor, true);
 }
 
+TSharedPtr<FJsonObject> FEpicUnrealMCPEditorCommands::HandleSetActorTransformsBulk(const TSharedPtr<FJsonObject>& Params)
+{
+    const TArray<TSharedPtr<FJsonValue>>* ActorEntries;
+    if (!Params->TryGetArrayField(TEXT("actors"), ActorEntries))
+    {
+        return FEpicUnrealMCPCommonUtils::CreateErrorResponse(TEXT("Missing 'actors' array parameter"));
+    }
+
+    // Name lookups go through the persistent actor index - no level scans
+    FEpicUnrealMCPActorIndex& ActorIndex = FEpicUnrealMCPActorIndex::Get();
+
+    // Apply every transform inside one editor transaction so the whole
+    // layout pass records as a single undo entry
+    FScopedTransaction Transaction(FText::FromString(TEXT("MCP Bulk Set Transforms")));
+
+    int32 UpdatedCount = 0;
+    TArray<TSharedPtr<FJsonValue>> Errors;
+
+    for (int32 EntryIndex = 0; EntryIndex < ActorEntries->Num(); ++EntryIndex)
+    {
+        const TSharedPtr<FJsonObject>* Entry;
+        if (!(*ActorEntries)[EntryIndex].IsValid() || !(*ActorEntries)[EntryIndex]->TryGetObject(Entry))
+        {
+            Errors.Add(MakeShared<FJsonValueString>(FString::Printf(TEXT("Entry %d is not an object"), EntryIndex)));
+            continue;
+        }
+
+        FString ActorName;
+        if (!(*Entry)->TryGetStringField(TEXT("name"), ActorName))
+        {
+            Errors.Add(MakeShared<FJsonValueString>(FString::Printf(TEXT("Entry %d missing 'name'"), EntryIndex)));
+            continue;
+        }
+
+        AActor* TargetActor = ActorIndex.FindActorByName(GWorld, ActorName);
+        if (!TargetActor)
+        {
+            Errors.Add(MakeShared<FJsonValueString>(FString::Printf(TEXT("Actor not found: %s"), *ActorName)));
+            continue;
+        }
+
+        FTransform NewTransform = TargetActor->GetTransform();
+
+        if ((*Entry)->HasField(TEXT("location")))
+        {
+            NewTransform.SetLocation(FEpicUnrealMCPCommonUtils::GetVectorFromJson(*Entry, TEXT("location")));
+        }
+        if ((*Entry)->HasField(TEXT("rotation")))
+        {
+            NewTransform.SetRotation(FQuat(FEpicUnrealMCPCommonUtils::GetRotatorFromJson(*Entry, TEXT("rotation"))));
+        }
+        if ((*Entry)->HasField(TEXT("scale")))
+        {
+            NewTransform.SetScale3D(FEpicUnrealMCPCommonUtils::GetVectorFromJson(*Entry, TEXT("scale")));
+        }
+
+        TargetActor->Modify();
+        TargetActor->SetActorTransform(NewTransform);
+        FEpicUnrealMCPActorIndex::Get().NotifyActorModified(TargetActor);
+        ++UpdatedCount;
+    }
+
+    // One viewport redraw for the whole batch instead of one per actor; a
+    // bulk edit session defers even that until end_bulk_edit
+    if (GEditor && !UEpicUnrealMCPBridge::IsBulkEditActive())
+    {
+        GEditor->RedrawLevelEditingViewports();
+    }
+
+    TSharedPtr<FJsonObject> ResultObj = MakeShared<FJsonObject>();
+    ResultObj->SetNumberField(TEXT("updated_count"), UpdatedCount);
+    if (Errors.Num() > 0)
+    {
+        ResultObj->SetArrayField(TEXT("errors"), Errors);
+    }
+    return ResultObj;
+}
+
+TArray<TSharedPtr<FStreamableHandle>> FEpicUnrealMCPEditorCommands::PreloadedAssetHandles;
+
+TSharedPtr<FJsonObject> FEpicUnrealMCPEditorCommands::HandlePreloadAssets(const TSharedPtr<FJsonObject>& Params)
+{
+    // release=true drops every pinned handle so warmed assets can be GC'd
+    // once a build is done
+    bool bRelease = false;
+    if (Params->TryGetBoolField(TEXT("release"), bRelease) && bRelease)
+    {
+        const int32 ReleasedCount = PreloadedAssetHandles.Num();
+        PreloadedAssetHandles.Reset();
+
+        TSharedPtr<FJsonObject> ResultObj = MakeShared<FJsonObject>();
+        ResultObj->SetNumberField(TEXT("released_count"), ReleasedCount);
+        return ResultObj;
+    }
+
+    const TArray<TSharedPtr<FJsonValue>>* PathsArray;
+    if (!Params->TryGetArrayField(TEXT("asset_paths"), PathsArray))
+    {
+        return FEpicUnrealMCPCommonUtils::CreateErrorResponse(TEXT("Missing 'asset_paths' array parameter"));
+    }
+
+    TArray<FSoftObjectPath> AssetPaths;
+    AssetPaths.Reserve(PathsArray->Num());
+    TArray<TSharedPtr<FJsonValue>> Errors;
+
+    for (const TSharedPtr<FJsonValue>& PathValue : *PathsArray)
+    {
+        FString Path;
+        if (!PathValue.IsValid() || !PathValue->TryGetString(Path) || Path.IsEmpty())
+        {
+            Errors.Add(MakeShared<FJsonValueString>(TEXT("Entry is not a non-empty string")));
+            continue;
+        }
+
+        FSoftObjectPath AssetPath(Path);
+        if (!AssetPath.IsValid())
+        {
+            Errors.Add(MakeShared<FJsonValueString>(FString::Printf(TEXT("Invalid asset path: %s"), *Path)));
+            continue;
+        }
+
+        AssetPaths.Add(MoveTemp(AssetPath));
+    }
+
+    if (AssetPaths.Num() > 0)
+    {
+        // Async load off the game thread; the handle is pinned so the warmed
+        // working set stays resident for every subsequent spawn
+        TSharedPtr<FStreamableHandle> Handle = UAssetManager::GetStreamableManager().RequestAsyncLoad(
+            AssetPaths,
+            FStreamableDelegate::CreateLambda([Count = AssetPaths.Num()]()
+            {
+                MCP_VERBOSE_LOG(TEXT("EpicUnrealMCPEditorCommands: Preloaded %d assets"), Count);
+            }));
+
+        if (Handle.IsValid())
+        {
+            PreloadedAssetHandles.Add(Handle);
+        }
+    }
+
+    TSharedPtr<FJsonObject> ResultObj = MakeShared<FJsonObject>();
+    ResultObj->SetNumberField(TEXT("requested_count"), AssetPaths.Num());
+    if (Errors.Num() > 0)
+    {
+        ResultObj->SetArrayField(TEXT("errors"), Errors);
+    }
+    return ResultObj;
+}
+
 TSharedPtr<FJsonObject> FEpicUnrealMCPEditorCommands::HandleSpawnBlueprintActor(const TSharedPtr<FJsonObject>& Params)
 {
-    // This function will now correctly call the implementation in BlueprintCommands
+    // Kept for direct callers; the bridge registry routes spawn_blueprint_actor
+    // straight to FEpicUnrealMCPBlueprintCommands
     FEpicUnrealMCPBlueprintCommands BlueprintCommands;
     return BlueprintCommands.HandleCommand(TEXT("spawn_blueprint_actor"), Params);
 }
@@ -0,0 +1,78 @@
+#include "EpicUnrealMCPServerStats.h"
+
+// Upper edges (ms) of the latency histogram buckets; the last bucket is open
+static const double GMCPLatencyBucketEdgesMs[FMCPCommandTypeStats::NumLatencyBuckets - 1] =
+{
+    1.0, 5.0, 10.0, 50.0, 100.0, 500.0
+};
+
+FEpicUnrealMCPServerStats& FEpicUnrealMCPServerStats::Get()
+{
+    static FEpicUnrealMCPServerStats Instance;
+    return Instance;
+}
+
+void FEpicUnrealMCPServerStats::RecordCommand(const FName& CommandType, double ElapsedMs)
+{
+    CommandsProcessed.fetch_add(1, std::memory_order_relaxed);
+
+    FMCPCommandTypeStats& Stats = CommandStats.FindOrAdd(CommandType);
+    ++Stats.Count;
+    Stats.TotalMs += ElapsedMs;
+    Stats.MaxMs = FMath::Max(Stats.MaxMs, ElapsedMs);
+
+    int32 Bucket = 0;
+    while (Bucket < FMCPCommandTypeStats::NumLatencyBuckets - 1 && ElapsedMs >= GMCPLatencyBucketEdgesMs[Bucket])
+    {
+        ++Bucket;
+    }
+    ++Stats.LatencyBuckets[Bucket];
+}
+
+TSharedPtr<FJsonObject> FEpicUnrealMCPServerStats::ToJson() const
+{
+    TSharedPtr<FJsonObject> ResultObj = MakeShared<FJsonObject>();
+    ResultObj->SetNumberField(TEXT("commands_processed"), (double)CommandsProcessed.load(std::memory_order_relaxed));
+    ResultObj->SetNumberField(TEXT("bytes_received"), (double)BytesReceived.load(std::memory_order_relaxed));
+    ResultObj->SetNumberField(TEXT("bytes_sent"), (double)BytesSent.load(std::memory_order_relaxed));
+
+    TSharedPtr<FJsonObject> CommandsObj = MakeShared<FJsonObject>();
+    for (const TPair<FName, FMCPCommandTypeStats>& Pair : CommandStats)
+    {
+        const FMCPCommandTypeStats& Stats = Pair.Value;
+
+        TSharedPtr<FJsonObject> StatsObj = MakeShared<FJsonObject>();
+        StatsObj->SetNumberField(TEXT("count"), (double)Stats.Count);
+        StatsObj->SetNumberField(TEXT("total_ms"), Stats.TotalMs);
+        StatsObj->SetNumberField(TEXT("avg_ms"), Stats.Count > 0 ? Stats.TotalMs / Stats.Count : 0.0);
+        StatsObj->SetNumberField(TEXT("max_ms"), Stats.MaxMs);
+
+        // Bucket labels mirror GMCPLatencyBucketEdgesMs
+        TArray<TSharedPtr<FJsonValue>> Buckets;
+        for (int32 Bucket = 0; Bucket < FMCPCommandTypeStats::NumLatencyBuckets; ++Bucket)
+        {
+            Buckets.Add(MakeShared<FJsonValueNumber>((double)Stats.LatencyBuckets[Bucket]));
+        }
+        StatsObj->SetArrayField(TEXT("latency_buckets"), Buckets);
+
+        CommandsObj->SetObjectField(Pair.Key.ToString(), StatsObj);
+    }
+    ResultObj->SetObjectField(TEXT("commands"), CommandsObj);
+
+    TArray<TSharedPtr<FJsonValue>> BucketEdges;
+    for (double Edge : GMCPLatencyBucketEdgesMs)
+    {
+        BucketEdges.Add(MakeShared<FJsonValueNumber>(Edge));
+    }
+    ResultObj->SetArrayField(TEXT("latency_bucket_edges_ms"), BucketEdges);
+
+    return ResultObj;
+}
+
+void FEpicUnrealMCPServerStats::Reset()
+{
+    CommandsProcessed.store(0, std::memory_order_relaxed);
+    BytesReceived.store(0, std::memory_order_relaxed);
+    BytesSent.store(0, std::memory_order_relaxed);
+    CommandStats.Empty();
+}
@@ -0,0 +1,401 @@
+#include "MCPClientConnection.h"
+#include "EpicUnrealMCPBridge.h"
+#include "Sockets.h"
+#include "SocketSubsystem.h"
+#include "HAL/RunnableThread.h"
+#include "Dom/JsonObject.h"
+#include "Dom/JsonValue.h"
+#include "Serialization/JsonSerializer.h"
+#include "Serialization/JsonReader.h"
+#include "Serialization/MemoryReader.h"
+#include "Misc/Compression.h"
+#include "Misc/ScopeLock.h"
+#include "Commands/EpicUnrealMCPCommonUtils.h"
+#include "EpicUnrealMCPLog.h"
+#include "EpicUnrealMCPServerStats.h"
+
+FMCPClientConnection::FMCPClientConnection(UEpicUnrealMCPBridge* InBridge, TSharedPtr<FSocket> InClientSocket)
+    : Bridge(InBridge)
+    , ClientSocket(InClientSocket)
+    , Thread(nullptr)
+    , bRunning(true)
+    , bFinished(false)
+{
+}
+
+FMCPClientConnection::~FMCPClientConnection()
+{
+    Shutdown();
+}
+
+void FMCPClientConnection::Start()
+{
+    static int32 ConnectionCounter = 0;
+    const FString ThreadName = FString::Printf(TEXT("UnrealMCPClient_%d"), ConnectionCounter++);
+    Thread = FRunnableThread::Create(this, *ThreadName, 0, TPri_Normal);
+}
+
+void FMCPClientConnection::Shutdown()
+{
+    bRunning = false;
+
+    if (Thread)
+    {
+        Thread->Kill(true);
+        delete Thread;
+        Thread = nullptr;
+    }
+
+    FScopeLock Lock(&SendCriticalSection);
+    if (ClientSocket.IsValid())
+    {
+        ISocketSubsystem::Get(PLATFORM_SOCKETSUBSYSTEM)->DestroySocket(ClientSocket.Get());
+        ClientSocket.Reset();
+    }
+}
+
+bool FMCPClientConnection::Init()
+{
+    return true;
+}
+
+uint32 FMCPClientConnection::Run()
+{
+    // Set socket options to improve connection stability
+    ClientSocket->SetNonBlocking(false);
+    ClientSocket->SetNoDelay(true);
+    int32 SocketBufferSize = 65536;  // 64KB buffer
+    ClientSocket->SetSendBufferSize(SocketBufferSize, SocketBufferSize);
+    ClientSocket->SetReceiveBufferSize(SocketBufferSize, SocketBufferSize);
+
+    uint8 Buffer[8192];
+
+    while (bRunning)
+    {
+        // Block until data is readable, waking periodically to honor Stop()
+        if (!ClientSocket->Wait(ESocketWaitConditions::WaitForRead, FTimespan::FromSeconds(1.0)))
+        {
+            if (ClientSocket->GetConnectionState() == SCS_ConnectionError)
+            {
+                UE_LOG(LogTemp, Display, TEXT("MCPClientConnection: Connection error, closing"));
+                break;
+            }
+            continue;
+        }
+
+        int32 BytesRead = 0;
+        if (!ClientSocket->Recv(Buffer, sizeof(Buffer), BytesRead))
+        {
+            int32 LastError = (int32)ISocketSubsystem::Get()->GetLastErrorCode();
+            if (LastError == SE_EINTR) // Interrupted system call
+            {
+                continue;
+            }
+            UE_LOG(LogTemp, Display, TEXT("MCPClientConnection: Client disconnected or error. Last error code: %d"), LastError);
+            break;
+        }
+
+        if (BytesRead == 0)
+        {
+            UE_LOG(LogTemp, Display, TEXT("MCPClientConnection: Client disconnected (zero bytes)"));
+            break;
+        }
+
+        FEpicUnrealMCPServerStats::Get().RecordBytesReceived(BytesRead);
+        ReceiveBuffer.Append(Buffer, BytesRead);
+
+        if (!ProcessReceiveBuffer())
+        {
+            break;
+        }
+    }
+
+    bFinished = true;
+    return 0;
+}
+
+bool FMCPClientConnection::ProcessReceiveBuffer()
+{
+    while (ReceiveBuffer.Num() > 0)
+    {
+        // Legacy clients open with raw JSON; framed clients send a length prefix
+        if (ReceiveBuffer[0] == (uint8)'{')
+        {
+            // Legacy mode: dispatch once the buffer forms complete JSON,
+            // parsing the UTF-8 bytes in place
+            {
+                FMemoryReaderView PayloadReader(MakeArrayView(ReceiveBuffer.GetData(), ReceiveBuffer.Num()));
+                TSharedRef<TJsonReader<UTF8CHAR>> Reader = TJsonReader<UTF8CHAR>::Create(&PayloadReader);
+
+                TSharedPtr<FJsonObject> JsonObject;
+                if (!FJsonSerializer::Deserialize(Reader, JsonObject) || !JsonObject.IsValid())
+                {
+                    // Not a complete message yet; wait for more data
+                    return true;
+                }
+            }
+
+            ProcessMessage(MakeArrayView(ReceiveBuffer.GetData(), ReceiveBuffer.Num()), /*bFramed=*/false);
+            ReceiveBuffer.Reset();
+            continue;
+        }
+
+        // Framed mode: 4-byte big-endian payload size followed by UTF-8 JSON
+        if (ReceiveBuffer.Num() < 4)
+        {
+            return true;
+        }
+
+        uint32 PayloadSize =
+            ((uint32)ReceiveBuffer[0] << 24) |
+            ((uint32)ReceiveBuffer[1] << 16) |
+            ((uint32)ReceiveBuffer[2] << 8) |
+            (uint32)ReceiveBuffer[3];
+
+        if (PayloadSize == 0 || PayloadSize > MaxFramePayloadSize)
+        {
+            UE_LOG(LogTemp, Warning, TEXT("MCPClientConnection: Invalid frame size %u, dropping connection"), PayloadSize);
+            return false;
+        }
+
+        if ((uint32)ReceiveBuffer.Num() < 4 + PayloadSize)
+        {
+            // Frame not complete yet; wait for more data
+            return true;
+        }
+
+        // Dispatch straight from the receive buffer; the params the command
+        // needs outlive the buffer as a parsed JSON tree
+        ProcessMessage(MakeArrayView(ReceiveBuffer.GetData() + 4, (int32)PayloadSize), /*bFramed=*/true);
+        ReceiveBuffer.RemoveAt(0, 4 + PayloadSize, EAllowShrinking::No);
+    }
+
+    return true;
+}
+
+void FMCPClientConnection::ProcessMessage(TArrayView<const uint8> Utf8Payload, bool bFramed)
+{
+#if UNREALMCP_VERBOSE_LOGGING
+    {
+        FUTF8ToTCHAR Converted((const ANSICHAR*)Utf8Payload.GetData(), Utf8Payload.Num());
+        MCP_VERBOSE_LOG(TEXT("MCPClientConnection: Received: %s"), *FString(Converted.Length(), Converted.Get()));
+    }
+#endif
+
+    // Parse the UTF-8 payload in place - no TCHAR copy of the message
+    TSharedPtr<FJsonObject> JsonMessage;
+    FMemoryReaderView PayloadReader(Utf8Payload);
+    TSharedRef<TJsonReader<UTF8CHAR>> Reader = TJsonReader<UTF8CHAR>::Create(&PayloadReader);
+
+    if (!FJsonSerializer::Deserialize(Reader, JsonMessage) || !JsonMessage.IsValid())
+    {
+        UE_LOG(LogTemp, Warning, TEXT("MCPClientConnection: Failed to parse JSON message (%d bytes)"), Utf8Payload.Num());
+        return;
+    }
+
+    // Extract command type ('type' is the wire format; 'command' kept for compatibility)
+    FString CommandType;
+    if (!JsonMessage->TryGetStringField(TEXT("type"), CommandType) &&
+        !JsonMessage->TryGetStringField(TEXT("command"), CommandType))
+    {
+        UE_LOG(LogTemp, Warning, TEXT("MCPClientConnection: Missing 'type' field in command"));
+        return;
+    }
+
+    // Parameters are optional
+    TSharedPtr<FJsonObject> Params = MakeShareable(new FJsonObject());
+    if (JsonMessage->HasField(TEXT("params")))
+    {
+        TSharedPtr<FJsonValue> ParamsValue = JsonMessage->TryGetField(TEXT("params"));
+        if (ParamsValue.IsValid() && ParamsValue->Type == EJson::Object)
+        {
+            Params = ParamsValue->AsObject();
+        }
+    }
+
+    // Protocol handshake: answered here on the connection, never routed
+    // through the bridge, so it stays a transport concern
+    if (CommandType == TEXT("set_protocol_options"))
+    {
+        HandleSetProtocolOptions(Params, bFramed);
+        return;
+    }
+
+    TSharedPtr<FJsonValue> RequestId = JsonMessage->TryGetField(TEXT("id"));
+
+    // Framed clients can ask for streaming delivery of large result sets;
+    // each chunk arrives as its own frame, terminated by the final envelope.
+    // Every frame echoes the request id (when given) so pipelined clients
+    // can correlate chunks interleaved with other tagged responses. Legacy
+    // (unframed) clients can't delimit chunks, so they always get a single
+    // response.
+    if (bFramed && Params->HasField(TEXT("stream")) && Params->GetBoolField(TEXT("stream")))
+    {
+        TSharedPtr<FMCPClientConnection> Self = AsShared();
+        if (Bridge->ExecuteCommandStreaming(CommandType, Params, RequestId,
+            [Self](const TArray<uint8>& Chunk)
+            {
+                if (!Self->SendResponse(Chunk, /*bFramed=*/true))
+                {
+                    UE_LOG(LogTemp, Warning, TEXT("MCPClientConnection: Failed to send stream chunk"));
+                }
+            }))
+        {
+            return;
+        }
+        // Command has no streaming path; fall through to normal dispatch
+    }
+
+    // Requests carrying an 'id' are pipelined: the command executes without
+    // blocking this thread and the tagged response is sent on completion
+    if (RequestId.IsValid())
+    {
+        TSharedPtr<FMCPClientConnection> Self = AsShared();
+        Bridge->ExecuteCommandAsync(CommandType, Params, RequestId,
+            [Self, bFramed](const TArray<uint8>& Response)
+            {
+                if (!Self->SendResponse(Response, bFramed))
+                {
+                    UE_LOG(LogTemp, Warning, TEXT("MCPClientConnection: Failed to send response"));
+                }
+            });
+        return;
+    }
+
+    // Without an id the client expects strict request/response lockstep
+    TArray<uint8> Response;
+    Bridge->ExecuteCommand(CommandType, Params, Response);
+
+    if (!SendResponse(Response, bFramed))
+    {
+        UE_LOG(LogTemp, Warning, TEXT("MCPClientConnection: Failed to send response"));
+    }
+}
+
+void FMCPClientConnection::HandleSetProtocolOptions(const TSharedPtr<FJsonObject>& Params, bool bFramed)
+{
+    bool bWantCompression = false;
+    Params->TryGetBoolField(TEXT("compress"), bWantCompression);
+
+    double RequestedThreshold = 0.0;
+    Params->TryGetNumberField(TEXT("compression_threshold"), RequestedThreshold);
+
+    {
+        FScopeLock Lock(&SendCriticalSection);
+        // Compression needs frame boundaries to mark, so legacy connections
+        // keep raw text no matter what they ask for
+        bCompressResponses = bWantCompression && bFramed;
+        if (RequestedThreshold > 0.0)
+        {
+            CompressionThresholdBytes = (int32)RequestedThreshold;
+        }
+    }
+
+    TSharedPtr<FJsonObject> ResultJson = MakeShared<FJsonObject>();
+    ResultJson->SetBoolField(TEXT("compress"), bCompressResponses);
+    ResultJson->SetNumberField(TEXT("compression_threshold"), CompressionThresholdBytes);
+
+    TSharedPtr<FJsonObject> ResponseJson = MakeShared<FJsonObject>();
+    ResponseJson->SetStringField(TEXT("status"), TEXT("success"));
+    ResponseJson->SetObjectField(TEXT("result"), ResultJson);
+
+    TArray<uint8> Response;
+    FEpicUnrealMCPCommonUtils::SerializeJsonToUtf8(ResponseJson.ToSharedRef(), Response);
+
+    // The acknowledgement itself is tiny and always goes uncompressed
+    if (!SendResponse(Response, bFramed))
+    {
+        UE_LOG(LogTemp, Warning, TEXT("MCPClientConnection: Failed to send protocol options response"));
+    }
+}
+
+bool FMCPClientConnection::SendResponse(const TArray<uint8>& Utf8Payload, bool bFramed)
+{
+#if UNREALMCP_VERBOSE_LOGGING
+    {
+        FUTF8ToTCHAR Converted((const ANSICHAR*)Utf8Payload.GetData(), Utf8Payload.Num());
+        MCP_VERBOSE_LOG(TEXT("MCPClientConnection: Sending response: %s"), *FString(Converted.Length(), Converted.Get()));
+    }
+#endif
+
+    // Async completions and the receive thread may send concurrently
+    FScopeLock Lock(&SendCriticalSection);
+
+    if (!ClientSocket.IsValid())
+    {
+        return false;
+    }
+
+    const int32 PayloadSize = Utf8Payload.Num();
+
+    // Deflate large responses when the client negotiated compression; the
+    // repetitive JSON these commands emit typically shrinks 10-20x
+    const uint8* WirePayload = Utf8Payload.GetData();
+    int32 WireSize = PayloadSize;
+    bool bCompressed = false;
+
+    if (bFramed && bCompressResponses && PayloadSize >= CompressionThresholdBytes)
+    {
+        int32 CompressedSize = FCompression::CompressMemoryBound(NAME_Zlib, PayloadSize);
+        CompressScratchBuffer.Reset();
+        CompressScratchBuffer.SetNumUninitialized(CompressedSize, EAllowShrinking::No);
+
+        // Fall back to raw on failure or when deflate doesn't actually shrink
+        if (FCompression::CompressMemory(NAME_Zlib, CompressScratchBuffer.GetData(), CompressedSize, Utf8Payload.GetData(), PayloadSize) &&
+            CompressedSize < PayloadSize)
+        {
+            WirePayload = CompressScratchBuffer.GetData();
+            WireSize = CompressedSize;
+            bCompressed = true;
+        }
+    }
+
+    // Reuse the pooled buffer; Reset is O(1) and keeps the grown capacity
+    SendScratchBuffer.Reset();
+    SendScratchBuffer.Reserve(WireSize + 8);
+
+    if (bFramed)
+    {
+        // Compressed frames set the high bit of the length prefix and insert
+        // the uncompressed size before the payload
+        const uint32 Prefix = (uint32)WireSize | (bCompressed ? CompressedFrameFlag : 0u);
+        SendScratchBuffer.Add((uint8)((Prefix >> 24) & 0xFF));
+        SendScratchBuffer.Add((uint8)((Prefix >> 16) & 0xFF));
+        SendScratchBuffer.Add((uint8)((Prefix >> 8) & 0xFF));
+        SendScratchBuffer.Add((uint8)(Prefix & 0xFF));
+
+        if (bCompressed)
+        {
+            SendScratchBuffer.Add((uint8)((PayloadSize >> 24) & 0xFF));
+            SendScratchBuffer.Add((uint8)((PayloadSize >> 16) & 0xFF));
+            SendScratchBuffer.Add((uint8)((PayloadSize >> 8) & 0xFF));
+            SendScratchBuffer.Add((uint8)(PayloadSize & 0xFF));
+        }
+    }
+
+    SendScratchBuffer.Append(WirePayload, WireSize);
+
+    // Send may accept fewer bytes than requested; loop until everything is out
+    int32 TotalSent = 0;
+    while (TotalSent < SendScratchBuffer.Num())
+    {
+        int32 BytesSent = 0;
+        if (!ClientSocket->Send(SendScratchBuffer.GetData() + TotalSent, SendScratchBuffer.Num() - TotalSent, BytesSent))
+        {
+            return false;
+        }
+        TotalSent += BytesSent;
+    }
+
+    FEpicUnrealMCPServerStats::Get().RecordBytesSent(TotalSent);
+    return true;
+}
+
+void FMCPClientConnection::Stop()
+{
+    bRunning = false;
+}
+
+void FMCPClientConnection::Exit()
+{
+}
@@ -2,6 +2,7 @@
 
 #include "CoreMinimal.h"
 #include "Json.h"
+#include "UObject/ObjectKey.h"
 
 // Forward declarations
 class AActor;
@@ -17,6 +18,16 @@ class UK2Node_InputAction;
 class UK2Node_Self;
 class UFunction;
 
+/** Plain-data copy of one actor, safe to serialize off the game thread */
+struct FMCPActorSnapshot
+{
+    FString Name;
+    FString Class;
+    FVector Location;
+    FRotator Rotation;
+    FVector Scale;
+};
+
 /**
  * Common utilities for EpicUnrealMCP commands
  */
@@ -26,6 +37,10 @@ public:
     // JSON utilities
     static TSharedPtr<FJsonObject> CreateErrorResponse(const FString& Message);
     static TSharedPtr<FJsonObject> CreateSuccessResponse(const TSharedPtr<FJsonObject>& Data = nullptr);
+
+    // Serializes a JSON tree straight into UTF-8 bytes ready for the socket,
+    // skipping the intermediate TCHAR string and its transcode
+    static void SerializeJsonToUtf8(const TSharedRef<FJsonObject>& Json, TArray<uint8>& OutBytes);
     static void GetIntArrayFromJson(const TSharedPtr<FJsonObject>& JsonObject, const FString& FieldName, TArray<int32>& OutArray);
     static void GetFloatArrayFromJson(const TSharedPtr<FJsonObject>& JsonObject, const FString& FieldName, TArray<float>& OutArray);
     static FVector2D GetVector2DFromJson(const TSharedPtr<FJsonObject>& JsonObject, const FString& FieldName);
@@ -35,8 +50,21 @@ public:
     // Actor utilities
     static TSharedPtr<FJsonValue> ActorToJson(AActor* Actor);
     static TSharedPtr<FJsonObject> ActorToJsonObject(AActor* Actor, bool bDetailed = false);
+
+    // Snapshot utilities: SnapshotActor copies the fields ActorToJson reads
+    // (game thread); the streaming writers below build the identical JSON
+    // from the copy and are safe on any thread
+    static FMCPActorSnapshot SnapshotActor(AActor* Actor);
+
+    // Streaming serialization: writes one actor object straight into an open
+    // UTF-8 writer, matching ActorToJson's field layout without allocating a
+    // DOM (~20 heap allocations per actor on the old path)
+    static void WriteActorSnapshotJson(TJsonWriter<UTF8CHAR>& Writer, const FMCPActorSnapshot& Snapshot);
+    static void WriteActorJson(TJsonWriter<UTF8CHAR>& Writer, AActor* Actor);
     
     // Blueprint utilities
+    // FindBlueprint resolves through a name cache; FindBlueprintByName is the
+    // uncached asset path search and load
     static UBlueprint* FindBlueprint(const FString& BlueprintName);
     static UBlueprint* FindBlueprintByName(const FString& BlueprintName);
     static UEdGraph* FindOrCreateEventGraph(UBlueprint* Blueprint);
@@ -54,6 +82,41 @@ public:
     static UK2Node_Event* FindExistingEventNode(UEdGraph* Graph, const FString& EventName);
 
     // Property utilities
-    static bool SetObjectProperty(UObject* Object, const FString& PropertyName, 
+    // Both resolve the FProperty through a (class, name) cache so repeated
+    // configuration of the same class skips the reflection walk
+    static bool SetObjectProperty(UObject* Object, const FString& PropertyName,
                                  const TSharedPtr<FJsonValue>& Value, FString& OutErrorMessage);
+
+    // Batch form: applies every field of Properties to Object in one call.
+    // Returns the number of properties set; each failure appends one
+    // "name: reason" message to OutErrors and the rest still apply.
+    static int32 SetObjectProperties(UObject* Object, const TSharedPtr<FJsonObject>& Properties,
+                                    TArray<FString>& OutErrors);
+
+private:
+    // Name -> blueprint cache so repeated lookups are a hash probe instead of
+    // an asset registry search; entries are dropped on asset add/remove/rename
+    static TMap<FString, TWeakObjectPtr<UBlueprint>> BlueprintCache;
+    static bool bBlueprintCacheDelegatesRegistered;
+
+    static void EnsureBlueprintCacheDelegates();
+    static void OnAssetAdded(const struct FAssetData& AssetData);
+    static void OnAssetRemoved(const struct FAssetData& AssetData);
+    static void OnAssetRenamed(const struct FAssetData& AssetData, const FString& OldObjectPath);
+
+    // (class, property name) -> resolved FProperty, cleared whenever any
+    // blueprint compiles: Kismet recompiles reuse the same class object
+    // while destroying and rebuilding its FProperty chain, so entries for
+    // it would dangle. FObjectKey keys keep a GC'd class from ever
+    // matching a freshly loaded one (game thread only)
+    static TMap<TPair<FObjectKey, FName>, FProperty*> PropertyLookupCache;
+    static bool bPropertyCacheDelegateRegistered;
+
+    static FProperty* FindCachedProperty(UClass* Class, const FName& PropertyName);
+    static void EnsurePropertyCacheDelegate();
+    static void OnBlueprintCompiled();
+
+    // Type-dispatch half of SetObjectProperty, shared with the batch form
+    static bool ApplyPropertyValue(UObject* Object, FProperty* Property, const FString& PropertyName,
+                                   const TSharedPtr<FJsonValue>& Value, FString& OutErrorMessage);
 }; 
\ No newline at end of file
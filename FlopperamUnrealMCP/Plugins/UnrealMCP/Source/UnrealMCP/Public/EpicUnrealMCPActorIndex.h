@@ -0,0 +1,115 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/WeakObjectPtr.h"
+
+class AActor;
+class UWorld;
+
+/**
+ * Persistent name -> actor index for the editor world.
+ *
+ * Built with one full level scan on first use and kept up to date through
+ * the editor's OnLevelActorAdded/OnLevelActorDeleted delegates, so name
+ * lookups are a hash probe instead of an O(level size) rescan per command.
+ *
+ * Alongside the name map it keeps per-sublevel and uniform-grid buckets so
+ * region-scoped queries (sublevel name or world-space box) touch only the
+ * actors in that region.
+ *
+ * Game thread only - command handlers all execute there, so no locking.
+ */
+class UNREALMCP_API FEpicUnrealMCPActorIndex
+{
+public:
+    static FEpicUnrealMCPActorIndex& Get();
+
+    // Returns the live actor with this name, or nullptr
+    AActor* FindActorByName(UWorld* World, const FString& Name);
+
+    // True if a live actor with this name exists
+    bool ContainsName(UWorld* World, const FString& Name);
+
+    // Collects all live actors whose name contains Pattern
+    void GetActorsMatchingPattern(UWorld* World, const FString& Pattern, TArray<AActor*>& OutActors);
+
+    // Region queries for level-streaming-aware commands. Cost is
+    // proportional to the sublevel / the grid cells the box overlaps (capped
+    // at one walk of the index), not the whole world.
+    void GetActorsInSublevel(UWorld* World, const FName& SublevelName, TArray<AActor*>& OutActors);
+    void GetActorsInBounds(UWorld* World, const FBox& Bounds, TArray<AActor*>& OutActors);
+
+    // Returns BaseName if free, otherwise the first free BaseName_N; each
+    // probe is a hash lookup against the index
+    FString MakeUniqueName(UWorld* World, const FString& BaseName);
+
+    // Monotonically increasing scene version, bumped on every tracked
+    // add/delete/move; the basis for incremental get_actors_in_level diffs
+    uint64 GetSceneVersion(UWorld* World);
+
+    // Marks an actor as modified at a new scene version. The editor's
+    // OnActorMoved covers gizmo moves; command handlers that set transforms
+    // programmatically call this themselves.
+    void NotifyActorModified(AActor* Actor);
+
+    // Fills the diff against SinceVersion. Returns false when the baseline
+    // is too old (trimmed removal history or a world change) and the caller
+    // should send a full snapshot instead. Removals are reported first so
+    // clients can apply delete-then-add for reused names.
+    bool GetChangesSince(UWorld* World, uint64 SinceVersion, TArray<AActor*>& OutAdded, TArray<AActor*>& OutModified, TArray<FName>& OutRemovedNames);
+
+private:
+    // Versions at which one actor appeared and last changed
+    struct FActorVersionInfo
+    {
+        uint64 AddedVersion = 0;
+        uint64 ModifiedVersion = 0;
+    };
+    FEpicUnrealMCPActorIndex() = default;
+
+    // Builds the index for World if it isn't current, and hooks the editor
+    // actor delegates on first use
+    void EnsureIndexBuilt(UWorld* World);
+
+    void OnLevelActorAdded(AActor* Actor);
+    void OnLevelActorDeleted(AActor* Actor);
+    void OnLevelActorMoved(AActor* Actor);
+
+    // Which buckets one actor currently sits in, so moves and deletes can
+    // update the region structures without a search
+    struct FActorBucketInfo
+    {
+        FName LevelName;
+        FIntVector Cell;
+    };
+
+    static FName GetActorLevelName(AActor* Actor);
+    static FIntVector GetSpatialCell(const FVector& Location);
+
+    void AddToBuckets(AActor* Actor);
+    void RemoveFromBuckets(const FName& ActorName);
+    void UpdateBucketsForMove(AActor* Actor);
+
+    TMap<FName, TWeakObjectPtr<AActor>> NameToActor;
+    TWeakObjectPtr<UWorld> IndexedWorld;
+    bool bDelegatesRegistered = false;
+
+    // Region buckets: sublevel name -> actor names, and uniform grid cell ->
+    // actor names; maintained from the same delegates as NameToActor
+    TMap<FName, TSet<FName>> LevelBuckets;
+    TMap<FIntVector, TSet<FName>> SpatialBuckets;
+    TMap<FName, FActorBucketInfo> ActorBuckets;
+
+    // Grid cell edge in world units (51.2 m)
+    static constexpr double SpatialCellSize = 5120.0;
+
+    // Scene diff state: per-actor versions, retained removals, and the oldest
+    // baseline the removal history can still answer
+    uint64 SceneVersion = 0;
+    uint64 DiffBaselineFloor = 0;
+    TMap<FName, FActorVersionInfo> ActorVersions;
+    TArray<TPair<FName, uint64>> RemovedActors;
+
+    // Removal history cap; clients further behind than this get a full snapshot
+    static constexpr int32 MaxRetainedRemovals = 8192;
+};
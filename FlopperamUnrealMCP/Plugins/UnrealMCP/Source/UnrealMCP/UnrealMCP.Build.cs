@@ -10,6 +10,11 @@ public class UnrealMCP : ModuleRules
 		
 		PublicDefinitions.Add("UNREALMCP_EXPORTS=1");
 
+		// Per-message hot-path logging (full request/response text, per-step
+		// traces) is compiled out by default; set to 1 when debugging the
+		// wire protocol. See EpicUnrealMCPLog.h.
+		PublicDefinitions.Add("UNREALMCP_VERBOSE_LOGGING=0");
+
 		PublicIncludePaths.AddRange(
 			new string[] {
 				// ... add public include paths required here ...
@@ -213,4 +213,36 @@ def safe_delete_actor(unreal_connection, actor_name: str) -> Dict[str, Any]:
         logger.error(f"Error in safe_delete_actor: {e}")
         return {"success": False, "message": str(e)}
 
+def safe_delete_actors_by_pattern(unreal_connection, pattern: str) -> Dict[str, Any]:
+    """
+    Delete every actor whose name contains the pattern, in one server-side pass.
+
+    The plugin matches against its actor index and destroys all matches in a
+    single transaction, so tearing down a generated town is one round trip
+    instead of one delete_actor call (and one level scan) per actor.
+
+    Args:
+        unreal_connection: The Unreal connection to use
+        pattern: Substring to match actor names against
+
+    Returns:
+        Response from Unreal Engine with deleted_count and deleted_actors
+    """
+    if not unreal_connection:
+        return {"success": False, "message": "No Unreal connection available"}
+
+    try:
+        response = unreal_connection.send_command("delete_actors_by_pattern", {"pattern": pattern})
+
+        if response and response.get("status") == "success":
+            result = response.get("result", {})
+            for name in result.get("deleted_actors", []):
+                _global_actor_name_manager.remove_actor(name)
+
+        return response or {"success": False, "message": "No response from Unreal"}
+
+    except Exception as e:
+        logger.error(f"Error in safe_delete_actors_by_pattern: {e}")
+        return {"success": False, "message": str(e)}
+
 
@@ -0,0 +1,206 @@
+"""
+Unreal MCP Benchmark Driver
+
+Measures end-to-end command latency and throughput through the plugin's real
+socket path (framing, dispatch, game-thread execution, response). Workloads:
+
+    ping         - minimal round trips (protocol floor)
+    echo         - round trips carrying a request payload of --payload-size bytes
+    large        - small requests with --payload-size byte responses (transfer path)
+    spawn_query  - mixed spawn_actor / get_actors_in_level / delete_actor traffic
+
+Reports p50/p95/p99 latency and commands/sec per workload, so perf changes
+ship with before/after numbers instead of eyeballed log timestamps.
+
+Usage:
+    python mcp_benchmark.py --workload ping --iterations 1000
+    python mcp_benchmark.py --workload large --payload-size 1048576
+    python mcp_benchmark.py --workload all
+"""
+
+import argparse
+import json
+import socket
+import struct
+import sys
+import time
+import zlib
+
+DEFAULT_HOST = "127.0.0.1"
+DEFAULT_PORT = 55557
+
+
+class BenchmarkConnection:
+    """Persistent framed connection to the plugin.
+
+    Unlike the tool server, which reconnects per command, the benchmark holds
+    one connection so measurements exclude TCP setup cost.
+    """
+
+    def __init__(self, host: str, port: int):
+        self.sock = socket.socket(socket.AF_INET, socket.SOCK_STREAM)
+        self.sock.setsockopt(socket.IPPROTO_TCP, socket.TCP_NODELAY, 1)
+        self.sock.settimeout(30)
+        self.sock.connect((host, port))
+
+    def close(self):
+        self.sock.close()
+
+    def send_command(self, command: str, params: dict = None) -> dict:
+        payload = json.dumps({"type": command, "params": params or {}}).encode("utf-8")
+        self.sock.sendall(struct.pack(">I", len(payload)) + payload)
+        return json.loads(self._receive_response().decode("utf-8"))
+
+    def _receive_response(self) -> bytes:
+        size = struct.unpack(">I", self._recv_exact(4))[0]
+        if size & 0x80000000:
+            compressed_size = size & 0x7FFFFFFF
+            self._recv_exact(4)  # uncompressed size; decompress verifies it
+            return zlib.decompress(self._recv_exact(compressed_size))
+        return self._recv_exact(size)
+
+    def _recv_exact(self, size: int) -> bytes:
+        chunks = []
+        remaining = size
+        while remaining > 0:
+            chunk = self.sock.recv(remaining)
+            if not chunk:
+                raise ConnectionError("Connection closed before receiving data")
+            chunks.append(chunk)
+            remaining -= len(chunk)
+        return b"".join(chunks)
+
+
+def percentile(sorted_samples, fraction):
+    """Nearest-rank percentile over an ascending sample list."""
+    if not sorted_samples:
+        return float("nan")
+    index = min(int(len(sorted_samples) * fraction), len(sorted_samples) - 1)
+    return sorted_samples[index]
+
+
+def run_workload(conn, name, iterations, make_command, on_response=None):
+    """Runs one workload and returns its latency samples in milliseconds.
+
+    make_command(i) returns (command, params) for iteration i; each command is
+    timed individually from send to complete response. on_response(i, response)
+    lets stateful workloads feed results back into later commands.
+    """
+    samples = []
+    failures = 0
+    wall_start = time.perf_counter()
+
+    for i in range(iterations):
+        command, params = make_command(i)
+        start = time.perf_counter()
+        response = conn.send_command(command, params)
+        samples.append((time.perf_counter() - start) * 1000.0)
+        if response.get("status") != "success":
+            failures += 1
+        elif on_response:
+            on_response(i, response)
+
+    wall_seconds = time.perf_counter() - wall_start
+    report(name, samples, failures, wall_seconds)
+    return samples
+
+
+def report(name, samples, failures, wall_seconds):
+    samples = sorted(samples)
+    print(f"\n{name} ({len(samples)} commands, {failures} failures)")
+    if not samples:
+        return
+    print(f"  throughput: {len(samples) / wall_seconds:10.1f} cmd/s")
+    print(f"  p50:        {percentile(samples, 0.50):10.3f} ms")
+    print(f"  p95:        {percentile(samples, 0.95):10.3f} ms")
+    print(f"  p99:        {percentile(samples, 0.99):10.3f} ms")
+    print(f"  min/max:    {samples[0]:10.3f} / {samples[-1]:.3f} ms")
+
+
+def workload_ping(conn, args):
+    run_workload(conn, "ping", args.iterations, lambda i: ("ping", {}))
+
+
+def workload_echo(conn, args):
+    payload = "x" * args.payload_size
+    run_workload(conn, f"echo ({args.payload_size} B request)", args.iterations,
+                 lambda i: ("echo", {"payload": payload}))
+
+
+def workload_large(conn, args):
+    run_workload(conn, f"large ({args.payload_size} B response)", args.iterations,
+                 lambda i: ("echo", {"response_size": args.payload_size}))
+
+
+def workload_spawn_query(conn, args):
+    """Mixed editor traffic: spawn a cube, query the level, delete the cube."""
+    # auto_unique may suffix the requested name, so each delete targets the
+    # name the spawn response actually reports
+    spawned_names = []
+
+    def make_command(i):
+        step = i % 3
+        if step == 0:
+            return ("spawn_actor", {
+                "name": f"BenchmarkActor_{i // 3}", "type": "StaticMeshActor",
+                "location": [i * 10.0, 0.0, 0.0], "auto_unique": True,
+            })
+        if step == 1:
+            return ("get_actors_in_level", {})
+        # Fall back to the requested name if the spawn itself failed; the
+        # delete then fails too and is counted with it
+        name = spawned_names.pop() if spawned_names else f"BenchmarkActor_{i // 3}"
+        return ("delete_actor", {"name": name})
+
+    def on_response(i, response):
+        if i % 3 == 0:
+            name = response.get("result", {}).get("name")
+            if name:
+                spawned_names.append(name)
+
+    # Round down to whole spawn/query/delete triples so no actors leak
+    iterations = (args.iterations // 3) * 3
+    run_workload(conn, "spawn_query", iterations, make_command, on_response)
+
+
+WORKLOADS = {
+    "ping": workload_ping,
+    "echo": workload_echo,
+    "large": workload_large,
+    "spawn_query": workload_spawn_query,
+}
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Unreal MCP latency/throughput benchmark")
+    parser.add_argument("--host", default=DEFAULT_HOST)
+    parser.add_argument("--port", type=int, default=DEFAULT_PORT)
+    parser.add_argument("--workload", choices=list(WORKLOADS) + ["all"], default="ping")
+    parser.add_argument("--iterations", type=int, default=1000)
+    parser.add_argument("--payload-size", type=int, default=65536,
+                        help="Request/response payload bytes for echo and large workloads")
+    parser.add_argument("--warmup", type=int, default=20,
+                        help="Untimed pings before measuring")
+    args = parser.parse_args()
+
+    try:
+        conn = BenchmarkConnection(args.host, args.port)
+    except OSError as e:
+        print(f"Failed to connect to {args.host}:{args.port}: {e}", file=sys.stderr)
+        return 1
+
+    try:
+        for _ in range(args.warmup):
+            conn.send_command("ping")
+
+        selected = WORKLOADS.values() if args.workload == "all" else [WORKLOADS[args.workload]]
+        for workload in selected:
+            workload(conn, args)
+    finally:
+        conn.close()
+
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
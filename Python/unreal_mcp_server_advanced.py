@@ -7,6 +7,8 @@ Contains only the advanced tools from the expanded MCP tool system to keep tool
 
 import logging
 import socket
+import struct
+import zlib
 import json
 import math
 from contextlib import asynccontextmanager
@@ -86,6 +88,7 @@ class UnrealConnection:
             self.socket.connect((UNREAL_HOST, UNREAL_PORT))
             self.connected = True
             logger.info("Connected to Unreal Engine")
+            self._negotiate_protocol_options()
             return True
             
         except Exception as e:
@@ -103,49 +106,69 @@ class UnrealConnection:
         self.socket = None
         self.connected = False
 
+    def _negotiate_protocol_options(self):
+        """Enable compressed responses for this connection.
+
+        Sends the transport-level set_protocol_options handshake right after
+        connecting; the plugin then deflates responses over its size
+        threshold. Older plugins answer with an error envelope, which simply
+        leaves the connection uncompressed.
+        """
+        try:
+            handshake = json.dumps({
+                "type": "set_protocol_options",
+                "params": {"compress": True}
+            }).encode('utf-8')
+            self.socket.sendall(struct.pack('>I', len(handshake)) + handshake)
+            ack = json.loads(self.receive_full_response(self.socket).decode('utf-8'))
+            if ack.get("status") != "success":
+                logger.info("Plugin does not support compressed responses")
+        except Exception as e:
+            logger.warning(f"Protocol options handshake failed: {e}")
+
     def receive_full_response(self, sock, buffer_size=4096) -> bytes:
-        """Receive a complete response from Unreal, handling chunked data."""
-        chunks = []
+        """Receive a complete framed response from Unreal.
+
+        The plugin sends responses as a 4-byte big-endian payload size
+        followed by UTF-8 JSON, so completeness is known up front instead
+        of re-parsing the accumulated buffer after every chunk. Compressed
+        frames set the high bit of the size prefix and carry the
+        uncompressed size in the next 4 bytes, followed by zlib data.
+        """
         sock.settimeout(30)
         try:
-            while True:
-                chunk = sock.recv(buffer_size)
-                if not chunk:
-                    if not chunks:
-                        raise Exception("Connection closed before receiving data")
-                    break
-                chunks.append(chunk)
-                
-                # Process the data received so far
-                data = b''.join(chunks)
-                decoded_data = data.decode('utf-8')
-                
-                # Try to parse as JSON to check if complete
-                try:
-                    json.loads(decoded_data)
-                    logger.info(f"Received complete response ({len(data)} bytes)")
-                    return data
-                except json.JSONDecodeError:
-                    # Not complete JSON yet, continue reading
-                    logger.debug(f"Received partial response, waiting for more data...")
-                    continue
-                except Exception as e:
-                    logger.warning(f"Error processing response chunk: {str(e)}")
-                    continue
+            header = self._recv_exact(sock, 4)
+            payload_size = struct.unpack('>I', header)[0]
+            if payload_size & 0x80000000:
+                compressed_size = payload_size & 0x7FFFFFFF
+                uncompressed_size = struct.unpack('>I', self._recv_exact(sock, 4))[0]
+                data = zlib.decompress(self._recv_exact(sock, compressed_size))
+                if len(data) != uncompressed_size:
+                    raise Exception(
+                        f"Decompressed size mismatch: expected {uncompressed_size}, got {len(data)}")
+                logger.info(f"Received compressed response ({compressed_size} -> {len(data)} bytes)")
+                return data
+            data = self._recv_exact(sock, payload_size)
+            logger.info(f"Received complete response ({len(data)} bytes)")
+            return data
         except socket.timeout:
             logger.warning("Socket timeout during receive")
-            if chunks:
-                data = b''.join(chunks)
-                try:
-                    json.loads(data.decode('utf-8'))
-                    logger.info(f"Using partial response after timeout ({len(data)} bytes)")
-                    return data
-                except:
-                    pass
             raise Exception("Timeout receiving Unreal response")
         except Exception as e:
             logger.error(f"Error during receive: {str(e)}")
             raise
+
+    def _recv_exact(self, sock, size) -> bytes:
+        """Receive exactly `size` bytes, handling short reads."""
+        chunks = []
+        remaining = size
+        while remaining > 0:
+            chunk = sock.recv(remaining)
+            if not chunk:
+                raise Exception("Connection closed before receiving data")
+            chunks.append(chunk)
+            remaining -= len(chunk)
+        return b''.join(chunks)
     
     def send_command(self, command: str, params: Dict[str, Any] = None) -> Optional[Dict[str, Any]]:
         """Send a command to Unreal Engine and get the response."""
@@ -170,11 +193,23 @@ class UnrealConnection:
             
             command_json = json.dumps(command_obj)
             logger.info(f"Sending command: {command_json}")
-            self.socket.sendall(command_json.encode('utf-8'))
+            payload = command_json.encode('utf-8')
+            self.socket.sendall(struct.pack('>I', len(payload)) + payload)
             
             response_data = self.receive_full_response(self.socket)
             response = json.loads(response_data.decode('utf-8'))
-            
+
+            # Streamed responses arrive as a series of {"status": "chunk"}
+            # frames followed by the final envelope; fold the chunked actors
+            # back into the final result so callers see one response
+            streamed_actors = []
+            while response.get("status") == "chunk":
+                streamed_actors.extend(response.get("actors", []))
+                response_data = self.receive_full_response(self.socket)
+                response = json.loads(response_data.decode('utf-8'))
+            if streamed_actors and response.get("status") == "success":
+                response.setdefault("result", {})["actors"] = streamed_actors
+
             logger.info(f"Complete response from Unreal: {response}")
             
             # Handle error responses
@@ -270,7 +305,8 @@ def get_actors_in_level(random_string: str = "") -> Dict[str, Any]:
         return {"success": False, "message": "Failed to connect to Unreal Engine"}
     
     try:
-        response = unreal.send_command("get_actors_in_level", {})
+        # Stream the response so huge levels arrive in bounded chunks
+        response = unreal.send_command("get_actors_in_level", {"stream": True})
         return response or {"success": False, "message": "No response from Unreal"}
     except Exception as e:
         logger.error(f"get_actors_in_level error: {e}")
@@ -0,0 +1,404 @@
+#include "EpicUnrealMCPActorIndex.h"
+#include "Editor.h"
+#include "Engine/Engine.h"
+#include "Engine/Level.h"
+#include "Engine/World.h"
+#include "EngineUtils.h"
+#include "GameFramework/Actor.h"
+#include "Misc/PackageName.h"
+#include "UObject/Package.h"
+
+FEpicUnrealMCPActorIndex& FEpicUnrealMCPActorIndex::Get()
+{
+    static FEpicUnrealMCPActorIndex Instance;
+    return Instance;
+}
+
+void FEpicUnrealMCPActorIndex::EnsureIndexBuilt(UWorld* World)
+{
+    if (bDelegatesRegistered == false && GEngine)
+    {
+        GEngine->OnLevelActorAdded().AddRaw(this, &FEpicUnrealMCPActorIndex::OnLevelActorAdded);
+        GEngine->OnLevelActorDeleted().AddRaw(this, &FEpicUnrealMCPActorIndex::OnLevelActorDeleted);
+        if (GEditor)
+        {
+            GEditor->OnActorMoved().AddRaw(this, &FEpicUnrealMCPActorIndex::OnLevelActorMoved);
+        }
+        bDelegatesRegistered = true;
+    }
+
+    if (IndexedWorld.Get() == World)
+    {
+        return;
+    }
+
+    // World changed (or first use): rebuild with one full scan. Diffs
+    // against versions from before the rebuild can't be answered, so the
+    // baseline floor moves up to the rebuild version.
+    NameToActor.Reset();
+    IndexedWorld = World;
+
+    ++SceneVersion;
+    DiffBaselineFloor = SceneVersion;
+    ActorVersions.Reset();
+    RemovedActors.Reset();
+
+    LevelBuckets.Reset();
+    SpatialBuckets.Reset();
+    ActorBuckets.Reset();
+
+    if (World)
+    {
+        for (TActorIterator<AActor> It(World); It; ++It)
+        {
+            NameToActor.Add(It->GetFName(), *It);
+            ActorVersions.Add(It->GetFName(), { SceneVersion, SceneVersion });
+            AddToBuckets(*It);
+        }
+    }
+}
+
+void FEpicUnrealMCPActorIndex::OnLevelActorAdded(AActor* Actor)
+{
+    if (Actor && Actor->GetWorld() == IndexedWorld.Get())
+    {
+        NameToActor.Add(Actor->GetFName(), Actor);
+
+        ++SceneVersion;
+        ActorVersions.Add(Actor->GetFName(), { SceneVersion, SceneVersion });
+        AddToBuckets(Actor);
+    }
+}
+
+void FEpicUnrealMCPActorIndex::OnLevelActorDeleted(AActor* Actor)
+{
+    if (Actor && Actor->GetWorld() == IndexedWorld.Get())
+    {
+        NameToActor.Remove(Actor->GetFName());
+        RemoveFromBuckets(Actor->GetFName());
+
+        ++SceneVersion;
+        ActorVersions.Remove(Actor->GetFName());
+        RemovedActors.Emplace(Actor->GetFName(), SceneVersion);
+
+        // Trim old removals; baselines older than the trimmed history get a
+        // full snapshot instead of a diff
+        while (RemovedActors.Num() > MaxRetainedRemovals)
+        {
+            DiffBaselineFloor = RemovedActors[0].Value;
+            RemovedActors.RemoveAt(0);
+        }
+    }
+}
+
+void FEpicUnrealMCPActorIndex::OnLevelActorMoved(AActor* Actor)
+{
+    NotifyActorModified(Actor);
+}
+
+void FEpicUnrealMCPActorIndex::NotifyActorModified(AActor* Actor)
+{
+    if (Actor && Actor->GetWorld() == IndexedWorld.Get())
+    {
+        ++SceneVersion;
+        FActorVersionInfo& Info = ActorVersions.FindOrAdd(Actor->GetFName());
+        if (Info.AddedVersion == 0)
+        {
+            Info.AddedVersion = SceneVersion;
+        }
+        Info.ModifiedVersion = SceneVersion;
+
+        UpdateBucketsForMove(Actor);
+    }
+}
+
+uint64 FEpicUnrealMCPActorIndex::GetSceneVersion(UWorld* World)
+{
+    EnsureIndexBuilt(World);
+    return SceneVersion;
+}
+
+bool FEpicUnrealMCPActorIndex::GetChangesSince(UWorld* World, uint64 SinceVersion, TArray<AActor*>& OutAdded, TArray<AActor*>& OutModified, TArray<FName>& OutRemovedNames)
+{
+    EnsureIndexBuilt(World);
+
+    if (SinceVersion < DiffBaselineFloor || SinceVersion > SceneVersion)
+    {
+        return false;
+    }
+
+    for (auto It = ActorVersions.CreateIterator(); It; ++It)
+    {
+        if (It->Value.ModifiedVersion <= SinceVersion)
+        {
+            continue;
+        }
+
+        AActor* Actor = FindActorByName(World, It->Key.ToString());
+        if (!Actor)
+        {
+            continue;
+        }
+
+        if (It->Value.AddedVersion > SinceVersion)
+        {
+            OutAdded.Add(Actor);
+        }
+        else
+        {
+            OutModified.Add(Actor);
+        }
+    }
+
+    for (const TPair<FName, uint64>& Removed : RemovedActors)
+    {
+        if (Removed.Value > SinceVersion)
+        {
+            OutRemovedNames.Add(Removed.Key);
+        }
+    }
+
+    return true;
+}
+
+AActor* FEpicUnrealMCPActorIndex::FindActorByName(UWorld* World, const FString& Name)
+{
+    EnsureIndexBuilt(World);
+
+    const TWeakObjectPtr<AActor>* Found = NameToActor.Find(FName(*Name));
+    if (!Found)
+    {
+        return nullptr;
+    }
+
+    AActor* Actor = Found->Get();
+    if (!IsValid(Actor))
+    {
+        // Stale entry (e.g. actor GC'd without a delegate firing)
+        NameToActor.Remove(FName(*Name));
+        return nullptr;
+    }
+
+    return Actor;
+}
+
+bool FEpicUnrealMCPActorIndex::ContainsName(UWorld* World, const FString& Name)
+{
+    return FindActorByName(World, Name) != nullptr;
+}
+
+FString FEpicUnrealMCPActorIndex::MakeUniqueName(UWorld* World, const FString& BaseName)
+{
+    if (!ContainsName(World, BaseName))
+    {
+        return BaseName;
+    }
+
+    // Low numbers fill in first, so reuse after deletions stays compact
+    for (int32 Suffix = 2; ; ++Suffix)
+    {
+        FString Candidate = FString::Printf(TEXT("%s_%d"), *BaseName, Suffix);
+        if (!ContainsName(World, Candidate))
+        {
+            return Candidate;
+        }
+    }
+}
+
+void FEpicUnrealMCPActorIndex::GetActorsMatchingPattern(UWorld* World, const FString& Pattern, TArray<AActor*>& OutActors)
+{
+    EnsureIndexBuilt(World);
+
+    for (auto It = NameToActor.CreateIterator(); It; ++It)
+    {
+        AActor* Actor = It->Value.Get();
+        if (!IsValid(Actor))
+        {
+            It.RemoveCurrent();
+            continue;
+        }
+
+        if (It->Key.ToString().Contains(Pattern))
+        {
+            OutActors.Add(Actor);
+        }
+    }
+}
+
+FName FEpicUnrealMCPActorIndex::GetActorLevelName(AActor* Actor)
+{
+    ULevel* Level = Actor->GetLevel();
+    if (!Level)
+    {
+        return NAME_None;
+    }
+
+    // Short package name, e.g. "Sub_Forest" for /Game/Maps/Sub_Forest -
+    // the name clients see in the Levels panel
+    return FName(*FPackageName::GetShortName(Level->GetOutermost()->GetName()));
+}
+
+FIntVector FEpicUnrealMCPActorIndex::GetSpatialCell(const FVector& Location)
+{
+    return FIntVector(
+        FMath::FloorToInt32(Location.X / SpatialCellSize),
+        FMath::FloorToInt32(Location.Y / SpatialCellSize),
+        FMath::FloorToInt32(Location.Z / SpatialCellSize));
+}
+
+void FEpicUnrealMCPActorIndex::AddToBuckets(AActor* Actor)
+{
+    const FName ActorName = Actor->GetFName();
+
+    FActorBucketInfo Info;
+    Info.LevelName = GetActorLevelName(Actor);
+    Info.Cell = GetSpatialCell(Actor->GetActorLocation());
+
+    LevelBuckets.FindOrAdd(Info.LevelName).Add(ActorName);
+    SpatialBuckets.FindOrAdd(Info.Cell).Add(ActorName);
+    ActorBuckets.Add(ActorName, Info);
+}
+
+void FEpicUnrealMCPActorIndex::RemoveFromBuckets(const FName& ActorName)
+{
+    FActorBucketInfo Info;
+    if (!ActorBuckets.RemoveAndCopyValue(ActorName, Info))
+    {
+        return;
+    }
+
+    if (TSet<FName>* LevelSet = LevelBuckets.Find(Info.LevelName))
+    {
+        LevelSet->Remove(ActorName);
+        if (LevelSet->IsEmpty())
+        {
+            LevelBuckets.Remove(Info.LevelName);
+        }
+    }
+
+    if (TSet<FName>* CellSet = SpatialBuckets.Find(Info.Cell))
+    {
+        CellSet->Remove(ActorName);
+        if (CellSet->IsEmpty())
+        {
+            SpatialBuckets.Remove(Info.Cell);
+        }
+    }
+}
+
+void FEpicUnrealMCPActorIndex::UpdateBucketsForMove(AActor* Actor)
+{
+    const FName ActorName = Actor->GetFName();
+    FActorBucketInfo* Info = ActorBuckets.Find(ActorName);
+    if (!Info)
+    {
+        AddToBuckets(Actor);
+        return;
+    }
+
+    const FIntVector NewCell = GetSpatialCell(Actor->GetActorLocation());
+    if (NewCell == Info->Cell)
+    {
+        return;
+    }
+
+    if (TSet<FName>* OldSet = SpatialBuckets.Find(Info->Cell))
+    {
+        OldSet->Remove(ActorName);
+        if (OldSet->IsEmpty())
+        {
+            SpatialBuckets.Remove(Info->Cell);
+        }
+    }
+    SpatialBuckets.FindOrAdd(NewCell).Add(ActorName);
+    Info->Cell = NewCell;
+}
+
+void FEpicUnrealMCPActorIndex::GetActorsInSublevel(UWorld* World, const FName& SublevelName, TArray<AActor*>& OutActors)
+{
+    EnsureIndexBuilt(World);
+
+    const TSet<FName>* Names = LevelBuckets.Find(SublevelName);
+    if (!Names)
+    {
+        return;
+    }
+
+    // Copy first: resolving a stale entry prunes the bucket being iterated
+    TArray<FName> ActorNames = Names->Array();
+    for (const FName& ActorName : ActorNames)
+    {
+        if (AActor* Actor = FindActorByName(World, ActorName.ToString()))
+        {
+            OutActors.Add(Actor);
+        }
+        else
+        {
+            RemoveFromBuckets(ActorName);
+        }
+    }
+}
+
+void FEpicUnrealMCPActorIndex::GetActorsInBounds(UWorld* World, const FBox& Bounds, TArray<AActor*>& OutActors)
+{
+    EnsureIndexBuilt(World);
+
+    const FIntVector MinCell = GetSpatialCell(Bounds.Min);
+    const FIntVector MaxCell = GetSpatialCell(Bounds.Max);
+
+    // A box spanning more cells than there are actors is cheaper to answer
+    // with one walk of the index; that caps the cost either way
+    const int64 CellSpan = (int64)(MaxCell.X - MinCell.X + 1)
+                         * (int64)(MaxCell.Y - MinCell.Y + 1)
+                         * (int64)(MaxCell.Z - MinCell.Z + 1);
+    if (CellSpan > NameToActor.Num())
+    {
+        for (auto It = NameToActor.CreateIterator(); It; ++It)
+        {
+            AActor* Actor = It->Value.Get();
+            if (!IsValid(Actor))
+            {
+                It.RemoveCurrent();
+                continue;
+            }
+
+            if (Bounds.IsInsideOrOn(Actor->GetActorLocation()))
+            {
+                OutActors.Add(Actor);
+            }
+        }
+        return;
+    }
+
+    for (int32 CellX = MinCell.X; CellX <= MaxCell.X; ++CellX)
+    {
+        for (int32 CellY = MinCell.Y; CellY <= MaxCell.Y; ++CellY)
+        {
+            for (int32 CellZ = MinCell.Z; CellZ <= MaxCell.Z; ++CellZ)
+            {
+                const TSet<FName>* Names = SpatialBuckets.Find(FIntVector(CellX, CellY, CellZ));
+                if (!Names)
+                {
+                    continue;
+                }
+
+                TArray<FName> ActorNames = Names->Array();
+                for (const FName& ActorName : ActorNames)
+                {
+                    AActor* Actor = FindActorByName(World, ActorName.ToString());
+                    if (!Actor)
+                    {
+                        RemoveFromBuckets(ActorName);
+                        continue;
+                    }
+
+                    // Edge cells can hold actors just outside the box
+                    if (Bounds.IsInsideOrOn(Actor->GetActorLocation()))
+                    {
+                        OutActors.Add(Actor);
+                    }
+                }
+            }
+        }
+    }
+}
@@ -1,5 +1,7 @@
 #include "EpicUnrealMCPBridge.h"
+#include "EpicUnrealMCPActorIndex.h"
 #include "MCPServerRunnable.h"
+#include "Engine/World.h"
 #include "Sockets.h"
 #include "SocketSubsystem.h"
 #include "HAL/RunnableThread.h"
@@ -10,6 +12,7 @@
 #include "Serialization/JsonSerializer.h"
 #include "Serialization/JsonReader.h"
 #include "Serialization/JsonWriter.h"
+#include "Serialization/MemoryWriter.h"
 #include "Engine/StaticMeshActor.h"
 #include "Engine/DirectionalLight.h"
 #include "Engine/PointLight.h"
@@ -22,6 +25,7 @@
 #include "Engine/Selection.h"
 #include "Kismet/GameplayStatics.h"
 #include "Async/Async.h"
+#include "Containers/Ticker.h"
 // Add Blueprint related includes
 #include "Engine/Blueprint.h"
 #include "Engine/BlueprintGeneratedClass.h"
@@ -50,21 +54,207 @@
 #include "GameFramework/InputSettings.h"
 #include "EditorSubsystem.h"
 #include "Subsystems/EditorActorSubsystem.h"
+#include "Editor.h"
+#include "Editor/TransBuffer.h"
 // Include our new command handler classes
 #include "Commands/EpicUnrealMCPEditorCommands.h"
 #include "Commands/EpicUnrealMCPBlueprintCommands.h"
 #include "Commands/EpicUnrealMCPCommonUtils.h"
+#include "EpicUnrealMCPLog.h"
+#include "EpicUnrealMCPServerStats.h"
+#include "EpicUnrealMCPJobManager.h"
 
 // Default settings
 #define MCP_SERVER_HOST "127.0.0.1"
 #define MCP_SERVER_PORT 55557
 
+bool UEpicUnrealMCPBridge::bBulkEditActive = false;
+bool UEpicUnrealMCPBridge::bBulkEditUndoSuspended = false;
+
 UEpicUnrealMCPBridge::UEpicUnrealMCPBridge()
 {
     EditorCommands = MakeShared<FEpicUnrealMCPEditorCommands>();
     BlueprintCommands = MakeShared<FEpicUnrealMCPBlueprintCommands>();
 }
 
+void UEpicUnrealMCPBridge::RegisterCommand(const FName& CommandType, FMCPCommandHandler Handler)
+{
+    if (CommandRegistry.Contains(CommandType))
+    {
+        UE_LOG(LogTemp, Warning, TEXT("EpicUnrealMCPBridge: Overwriting handler for command '%s'"), *CommandType.ToString());
+    }
+    CommandRegistry.Add(CommandType, MoveTemp(Handler));
+}
+
+void UEpicUnrealMCPBridge::RegisterBuiltInCommands()
+{
+    RegisterCommand(TEXT("ping"), [](const TSharedPtr<FJsonObject>& Params)
+    {
+        TSharedPtr<FJsonObject> ResultJson = MakeShareable(new FJsonObject);
+        ResultJson->SetStringField(TEXT("message"), TEXT("pong"));
+        return ResultJson;
+    });
+
+    // Echo for benchmarking the full socket -> dispatch -> response path:
+    // returns its params untouched, plus an optional generated payload of
+    // response_size bytes for large-transfer measurements
+    RegisterCommand(TEXT("echo"), [](const TSharedPtr<FJsonObject>& Params)
+    {
+        TSharedPtr<FJsonObject> ResultJson = MakeShareable(new FJsonObject);
+        ResultJson->SetObjectField(TEXT("echo"), Params);
+
+        double ResponseSize = 0.0;
+        if (Params.IsValid() && Params->TryGetNumberField(TEXT("response_size"), ResponseSize) && ResponseSize > 0.0)
+        {
+            ResultJson->SetStringField(TEXT("payload"), FString::ChrN((int32)ResponseSize, TEXT('x')));
+        }
+
+        return ResultJson;
+    });
+
+    // Batch execution - runs all sub-commands inside a single game thread task
+    RegisterCommand(TEXT("batch"), [this](const TSharedPtr<FJsonObject>& Params)
+    {
+        return ExecuteBatchCommand(Params);
+    });
+
+    // Time-sliced batch execution - entries run in per-tick slices under a
+    // millisecond budget and the result arrives through the job API
+    RegisterCommand(TEXT("submit_sliced_batch"), [this](const TSharedPtr<FJsonObject>& Params)
+    {
+        return SubmitSlicedBatch(Params);
+    });
+
+    // Server counters that replaced per-message logging; pass reset=true to
+    // zero them after the snapshot
+    RegisterCommand(TEXT("get_server_stats"), [](const TSharedPtr<FJsonObject>& Params)
+    {
+        TSharedPtr<FJsonObject> ResultJson = FEpicUnrealMCPServerStats::Get().ToJson();
+        if (Params.IsValid() && Params->HasField(TEXT("reset")) && Params->GetBoolField(TEXT("reset")))
+        {
+            FEpicUnrealMCPServerStats::Get().Reset();
+        }
+        return ResultJson;
+    });
+
+    // Async job API for long-running commands (e.g. compile_blueprint):
+    // submit_job returns a job ID immediately instead of making every client
+    // on the channel wait behind the command's Future
+    RegisterCommand(TEXT("submit_job"), [this](const TSharedPtr<FJsonObject>& Params)
+    {
+        TSharedPtr<FJsonObject> ResultJson = MakeShareable(new FJsonObject);
+
+        FString SubCommandType;
+        if (!Params.IsValid() || !Params->TryGetStringField(TEXT("type"), SubCommandType))
+        {
+            ResultJson->SetBoolField(TEXT("success"), false);
+            ResultJson->SetStringField(TEXT("error"), TEXT("Missing 'type' parameter"));
+            return ResultJson;
+        }
+
+        // Jobs wrapping the job API itself would deadlock the polling model
+        if (SubCommandType == TEXT("submit_job") || SubCommandType == TEXT("get_job_status") || SubCommandType == TEXT("get_job_result"))
+        {
+            ResultJson->SetBoolField(TEXT("success"), false);
+            ResultJson->SetStringField(TEXT("error"), FString::Printf(TEXT("Command '%s' cannot be submitted as a job"), *SubCommandType));
+            return ResultJson;
+        }
+
+        TSharedPtr<FJsonObject> SubParams = MakeShareable(new FJsonObject);
+        if (Params->HasField(TEXT("params")))
+        {
+            TSharedPtr<FJsonValue> ParamsValue = Params->TryGetField(TEXT("params"));
+            if (ParamsValue.IsValid() && ParamsValue->Type == EJson::Object)
+            {
+                SubParams = ParamsValue->AsObject();
+            }
+        }
+
+        const FString JobId = FEpicUnrealMCPJobManager::Get().SubmitJob(SubCommandType,
+            [this, SubCommandType, SubParams]()
+            {
+                return ExecuteCommandOnGameThread(SubCommandType, SubParams);
+            });
+
+        ResultJson->SetStringField(TEXT("job_id"), JobId);
+        ResultJson->SetStringField(TEXT("command"), SubCommandType);
+        return ResultJson;
+    });
+
+    RegisterCommand(TEXT("get_job_status"), [](const TSharedPtr<FJsonObject>& Params)
+    {
+        TSharedPtr<FJsonObject> ResultJson = MakeShareable(new FJsonObject);
+
+        FString JobId;
+        if (!Params.IsValid() || !Params->TryGetStringField(TEXT("job_id"), JobId))
+        {
+            ResultJson->SetBoolField(TEXT("success"), false);
+            ResultJson->SetStringField(TEXT("error"), TEXT("Missing 'job_id' parameter"));
+            return ResultJson;
+        }
+
+        TSharedPtr<FJsonObject> StatusObj = FEpicUnrealMCPJobManager::Get().GetJobStatus(JobId);
+        if (!StatusObj.IsValid())
+        {
+            ResultJson->SetBoolField(TEXT("success"), false);
+            ResultJson->SetStringField(TEXT("error"), FString::Printf(TEXT("Unknown job: %s"), *JobId));
+            return ResultJson;
+        }
+
+        return StatusObj;
+    });
+
+    RegisterCommand(TEXT("get_job_result"), [](const TSharedPtr<FJsonObject>& Params)
+    {
+        TSharedPtr<FJsonObject> ResultJson = MakeShareable(new FJsonObject);
+
+        FString JobId;
+        if (!Params.IsValid() || !Params->TryGetStringField(TEXT("job_id"), JobId))
+        {
+            ResultJson->SetBoolField(TEXT("success"), false);
+            ResultJson->SetStringField(TEXT("error"), TEXT("Missing 'job_id' parameter"));
+            return ResultJson;
+        }
+
+        TSharedPtr<FJsonObject> StatusObj = FEpicUnrealMCPJobManager::Get().GetJobStatus(JobId);
+        if (!StatusObj.IsValid())
+        {
+            ResultJson->SetBoolField(TEXT("success"), false);
+            ResultJson->SetStringField(TEXT("error"), FString::Printf(TEXT("Unknown job: %s"), *JobId));
+            return ResultJson;
+        }
+
+        EMCPJobState State = EMCPJobState::Queued;
+        TSharedPtr<FJsonObject> Envelope = FEpicUnrealMCPJobManager::Get().TakeJobResult(JobId, State);
+        if (!Envelope.IsValid())
+        {
+            ResultJson->SetBoolField(TEXT("success"), false);
+            ResultJson->SetStringField(TEXT("error"), FString::Printf(TEXT("Job %s is not complete (state: %s)"), *JobId,
+                *StatusObj->GetStringField(TEXT("state"))));
+            return ResultJson;
+        }
+
+        // The job result is the command's full response envelope
+        ResultJson->SetStringField(TEXT("job_id"), JobId);
+        ResultJson->SetObjectField(TEXT("response"), Envelope);
+        return ResultJson;
+    });
+
+    // Bulk edit session control - suspends per-mutation editor bookkeeping
+    // between the two calls and does one consolidated refresh at the end
+    RegisterCommand(TEXT("begin_bulk_edit"), [this](const TSharedPtr<FJsonObject>& Params)
+    {
+        return BeginBulkEdit(Params);
+    });
+    RegisterCommand(TEXT("end_bulk_edit"), [this](const TSharedPtr<FJsonObject>& Params)
+    {
+        return EndBulkEdit();
+    });
+
+    EditorCommands->RegisterCommands(this);
+    BlueprintCommands->RegisterCommands(this);
+}
+
 UEpicUnrealMCPBridge::~UEpicUnrealMCPBridge()
 {
     EditorCommands.Reset();
@@ -83,6 +273,8 @@ void UEpicUnrealMCPBridge::Initialize(FSubsystemCollectionBase& Collection)
     Port = MCP_SERVER_PORT;
     FIPv4Address::Parse(MCP_SERVER_HOST, ServerAddress);
 
+    RegisterBuiltInCommands();
+
     // Start the server automatically
     StartServer();
 }
@@ -91,6 +283,14 @@ void UEpicUnrealMCPBridge::Initialize(FSubsystemCollectionBase& Collection)
 void UEpicUnrealMCPBridge::Deinitialize()
 {
     UE_LOG(LogTemp, Display, TEXT("EpicUnrealMCPBridge: Shutting down"));
+
+    // Never leave the editor with redraws or undo recording suspended if a
+    // client vanished mid-session
+    if (bBulkEditActive)
+    {
+        EndBulkEdit();
+    }
+
     StopServer();
 }
 
@@ -192,103 +392,490 @@ void UEpicUnrealMCPBridge::StopServer()
 }
 
 // Execute a command received from a client
-FString UEpicUnrealMCPBridge::ExecuteCommand(const FString& CommandType, const TSharedPtr<FJsonObject>& Params)
+void UEpicUnrealMCPBridge::ExecuteCommand(const FString& CommandType, const TSharedPtr<FJsonObject>& Params, TArray<uint8>& OutUtf8Response)
 {
-    UE_LOG(LogTemp, Display, TEXT("EpicUnrealMCPBridge: Executing command: %s"), *CommandType);
-    
-    // Create a promise to wait for the result
-    TPromise<FString> Promise;
-    TFuture<FString> Future = Promise.GetFuture();
-    
-    // Queue execution on Game Thread
-    AsyncTask(ENamedThreads::GameThread, [this, CommandType, Params, Promise = MoveTemp(Promise)]() mutable
+    MCP_VERBOSE_LOG(TEXT("EpicUnrealMCPBridge: Executing command: %s"), *CommandType);
+
+    // The big actor queries serialize megabytes for large levels; only the
+    // plain-struct snapshot runs on the game thread and the JSON is written
+    // here on the socket thread. Diff requests (since_version) and
+    // region-scoped queries (sublevel / bounds) go through the registry
+    // handler, which consults the index's version and region tracking.
+    FString Pattern;
+    const bool bRegionFiltered = FEpicUnrealMCPEditorCommands::HasRegionFilter(Params);
+    const bool bSnapshotAllActors = CommandType == TEXT("get_actors_in_level") && !bRegionFiltered && (!Params.IsValid() || !Params->HasField(TEXT("since_version")));
+    const bool bSnapshotByPattern = CommandType == TEXT("find_actors_by_name") && !bRegionFiltered && Params.IsValid() && Params->TryGetStringField(TEXT("pattern"), Pattern);
+    if (bSnapshotAllActors || bSnapshotByPattern)
     {
-        TSharedPtr<FJsonObject> ResponseJson = MakeShareable(new FJsonObject);
-        
-        try
+        TPromise<TArray<FMCPActorSnapshot>> SnapshotPromise;
+        TFuture<TArray<FMCPActorSnapshot>> SnapshotFuture = SnapshotPromise.GetFuture();
+
+        // Written on the game thread before the promise resolves; the
+        // blocking Get() below orders the read after it
+        TOptional<uint64> SceneVersion;
+
+        AsyncTask(ENamedThreads::GameThread, [this, CommandType, bSnapshotByPattern, Pattern, &SceneVersion, SnapshotPromise = MoveTemp(SnapshotPromise)]() mutable
         {
-            TSharedPtr<FJsonObject> ResultJson;
-            
-            if (CommandType == TEXT("ping"))
+            const double StartTime = FPlatformTime::Seconds();
+            TArray<FMCPActorSnapshot> Snapshots;
+            if (bSnapshotByPattern)
             {
-                ResultJson = MakeShareable(new FJsonObject);
-                ResultJson->SetStringField(TEXT("message"), TEXT("pong"));
+                EditorCommands->SnapshotActorsMatchingPattern(Pattern, Snapshots);
             }
-            // Editor Commands (including actor manipulation)
-            else if (CommandType == TEXT("get_actors_in_level") || 
-                     CommandType == TEXT("find_actors_by_name") ||
-                     CommandType == TEXT("spawn_actor") ||
-                     CommandType == TEXT("delete_actor") || 
-                     CommandType == TEXT("set_actor_transform") ||
-                     CommandType == TEXT("spawn_blueprint_actor"))
+            else
             {
-                ResultJson = EditorCommands->HandleCommand(CommandType, Params);
+                EditorCommands->SnapshotActorsInLevel(Snapshots);
+                SceneVersion = FEpicUnrealMCPActorIndex::Get().GetSceneVersion(GWorld);
             }
-            // Blueprint Commands
-            else if (CommandType == TEXT("create_blueprint") || 
-                     CommandType == TEXT("add_component_to_blueprint") || 
-                     CommandType == TEXT("set_physics_properties") ||
-                     CommandType == TEXT("compile_blueprint") ||
-                     CommandType == TEXT("set_static_mesh_properties") ||
-                     CommandType == TEXT("set_mesh_material_color") ||
-                     CommandType == TEXT("get_available_materials") ||
-                     CommandType == TEXT("apply_material_to_actor") ||
-                     CommandType == TEXT("apply_material_to_blueprint") ||
-                     CommandType == TEXT("get_actor_material_info") ||
-                     CommandType == TEXT("get_blueprint_material_info"))
+            FEpicUnrealMCPServerStats::Get().RecordCommand(FName(*CommandType), (FPlatformTime::Seconds() - StartTime) * 1000.0);
+            SnapshotPromise.SetValue(MoveTemp(Snapshots));
+        });
+
+        const TArray<FMCPActorSnapshot> Snapshots = SnapshotFuture.Get();
+        SerializeSnapshotResponse(Snapshots, nullptr, SceneVersion, OutUtf8Response);
+        return;
+    }
+
+    // The game thread task only builds the JSON tree; serialization to UTF-8
+    // happens here on the calling thread
+    TPromise<TSharedPtr<FJsonObject>> Promise;
+    TFuture<TSharedPtr<FJsonObject>> Future = Promise.GetFuture();
+
+    AsyncTask(ENamedThreads::GameThread, [this, CommandType, Params, Promise = MoveTemp(Promise)]() mutable
+    {
+        Promise.SetValue(ExecuteCommandOnGameThread(CommandType, Params));
+    });
+
+    TSharedPtr<FJsonObject> ResponseJson = Future.Get();
+    FEpicUnrealMCPCommonUtils::SerializeJsonToUtf8(ResponseJson.ToSharedRef(), OutUtf8Response);
+}
+
+// Execute a command without blocking the calling thread; the response is
+// delivered through OnComplete as soon as the game thread task finishes
+void UEpicUnrealMCPBridge::ExecuteCommandAsync(const FString& CommandType, const TSharedPtr<FJsonObject>& Params, const TSharedPtr<FJsonValue>& RequestId, TFunction<void(const TArray<uint8>&)> OnComplete)
+{
+    MCP_VERBOSE_LOG(TEXT("EpicUnrealMCPBridge: Executing command (async): %s"), *CommandType);
+
+    // Same snapshot split as the synchronous path, with the JSON written on
+    // a task graph worker instead of inside the game thread task; diff and
+    // region-scoped requests route through the registry handler like the
+    // sync path
+    FString Pattern;
+    const bool bRegionFiltered = FEpicUnrealMCPEditorCommands::HasRegionFilter(Params);
+    const bool bSnapshotAllActors = CommandType == TEXT("get_actors_in_level") && !bRegionFiltered && (!Params.IsValid() || !Params->HasField(TEXT("since_version")));
+    const bool bSnapshotByPattern = CommandType == TEXT("find_actors_by_name") && !bRegionFiltered && Params.IsValid() && Params->TryGetStringField(TEXT("pattern"), Pattern);
+    if (bSnapshotAllActors || bSnapshotByPattern)
+    {
+        AsyncTask(ENamedThreads::GameThread, [this, CommandType, bSnapshotByPattern, Pattern, RequestId, OnComplete = MoveTemp(OnComplete)]() mutable
+        {
+            const double StartTime = FPlatformTime::Seconds();
+            TArray<FMCPActorSnapshot> Snapshots;
+            TOptional<uint64> SceneVersion;
+            if (bSnapshotByPattern)
             {
-                ResultJson = BlueprintCommands->HandleCommand(CommandType, Params);
+                EditorCommands->SnapshotActorsMatchingPattern(Pattern, Snapshots);
             }
-
             else
             {
-                ResponseJson->SetStringField(TEXT("status"), TEXT("error"));
-                ResponseJson->SetStringField(TEXT("error"), FString::Printf(TEXT("Unknown command: %s"), *CommandType));
-                
-                FString ResultString;
-                TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&ResultString);
-                FJsonSerializer::Serialize(ResponseJson.ToSharedRef(), Writer);
-                Promise.SetValue(ResultString);
-                return;
+                EditorCommands->SnapshotActorsInLevel(Snapshots);
+                SceneVersion = FEpicUnrealMCPActorIndex::Get().GetSceneVersion(GWorld);
             }
-            
-            // Check if the result contains an error
-            bool bSuccess = true;
-            FString ErrorMessage;
-            
-            if (ResultJson->HasField(TEXT("success")))
+            FEpicUnrealMCPServerStats::Get().RecordCommand(FName(*CommandType), (FPlatformTime::Seconds() - StartTime) * 1000.0);
+
+            AsyncTask(ENamedThreads::AnyBackgroundThreadNormalTask, [this, Snapshots = MoveTemp(Snapshots), RequestId, SceneVersion, OnComplete = MoveTemp(OnComplete)]()
+            {
+                TArray<uint8> Utf8Response;
+                SerializeSnapshotResponse(Snapshots, RequestId, SceneVersion, Utf8Response);
+                OnComplete(Utf8Response);
+            });
+        });
+        return;
+    }
+
+    AsyncTask(ENamedThreads::GameThread, [this, CommandType, Params, RequestId, OnComplete = MoveTemp(OnComplete)]() mutable
+    {
+        TSharedPtr<FJsonObject> ResponseJson = ExecuteCommandOnGameThread(CommandType, Params);
+
+        // Echo the client's request ID so pipelined responses can be matched
+        if (RequestId.IsValid())
+        {
+            ResponseJson->SetField(TEXT("id"), RequestId);
+        }
+
+        // Serialization and the blocking socket send inside OnComplete run
+        // on a task graph worker: a client that stops draining its socket
+        // stalls that worker, never the game thread
+        AsyncTask(ENamedThreads::AnyBackgroundThreadNormalTask, [ResponseJson, OnComplete = MoveTemp(OnComplete)]()
+        {
+            TArray<uint8> Utf8Response;
+            FEpicUnrealMCPCommonUtils::SerializeJsonToUtf8(ResponseJson.ToSharedRef(), Utf8Response);
+            OnComplete(Utf8Response);
+        });
+    });
+}
+
+// Serialize the actors response straight from snapshots into UTF-8 bytes;
+// safe on any thread since it only touches plain data. No DOM is built -
+// the writer emits each actor directly, so a 50k-actor response costs the
+// output buffer instead of a million shared-pointer allocations.
+void UEpicUnrealMCPBridge::SerializeSnapshotResponse(const TArray<FMCPActorSnapshot>& Snapshots, const TSharedPtr<FJsonValue>& RequestId, const TOptional<uint64>& SceneVersion, TArray<uint8>& OutUtf8Response)
+{
+    // Rough per-actor estimate so the buffer doesn't regrow repeatedly
+    OutUtf8Response.Reserve(Snapshots.Num() * 192 + 256);
+
+    FMemoryWriter MemoryWriter(OutUtf8Response);
+    TSharedRef<TJsonWriter<UTF8CHAR>> Writer = TJsonWriter<UTF8CHAR>::Create(&MemoryWriter);
+
+    Writer->WriteObjectStart();
+    Writer->WriteValue(TEXT("status"), TEXT("success"));
+
+    Writer->WriteObjectStart(TEXT("result"));
+    if (SceneVersion.IsSet())
+    {
+        // Same tagging as the registry handler's full snapshot, so a plain
+        // query can start diffing from the version it was served at
+        Writer->WriteValue(TEXT("full"), true);
+        Writer->WriteValue(TEXT("scene_version"), (double)SceneVersion.GetValue());
+    }
+    Writer->WriteArrayStart(TEXT("actors"));
+    for (const FMCPActorSnapshot& Snapshot : Snapshots)
+    {
+        FEpicUnrealMCPCommonUtils::WriteActorSnapshotJson(*Writer, Snapshot);
+    }
+    Writer->WriteArrayEnd();
+    Writer->WriteObjectEnd();
+
+    if (RequestId.IsValid())
+    {
+        if (RequestId->Type == EJson::Number)
+        {
+            Writer->WriteValue(TEXT("id"), RequestId->AsNumber());
+        }
+        else
+        {
+            Writer->WriteValue(TEXT("id"), RequestId->AsString());
+        }
+    }
+
+    Writer->WriteObjectEnd();
+    Writer->Close();
+}
+
+// Open a bulk edit session: realtime viewport redraws are suspended and,
+// when disable_undo is set, per-actor undo recording is skipped for the
+// duration. Generated content is rebuilt rather than undone actor-by-actor,
+// so the transaction serialization is pure overhead there.
+TSharedPtr<FJsonObject> UEpicUnrealMCPBridge::BeginBulkEdit(const TSharedPtr<FJsonObject>& Params)
+{
+    TSharedPtr<FJsonObject> ResultJson = MakeShareable(new FJsonObject);
+
+    if (bBulkEditActive)
+    {
+        ResultJson->SetBoolField(TEXT("success"), false);
+        ResultJson->SetStringField(TEXT("error"), TEXT("Bulk edit session already active"));
+        return ResultJson;
+    }
+
+    bBulkEditActive = true;
+
+    if (GEditor)
+    {
+        GEditor->DisableRealtimeViewports();
+
+        bool bDisableUndo = false;
+        if (Params.IsValid() && Params->TryGetBoolField(TEXT("disable_undo"), bDisableUndo) && bDisableUndo)
+        {
+            if (UTransBuffer* TransBuffer = Cast<UTransBuffer>(GEditor->Trans))
             {
-                bSuccess = ResultJson->GetBoolField(TEXT("success"));
-                if (!bSuccess && ResultJson->HasField(TEXT("error")))
-                {
-                    ErrorMessage = ResultJson->GetStringField(TEXT("error"));
-                }
+                TransBuffer->DisableObjectSerialization();
+                bBulkEditUndoSuspended = true;
             }
-            
-            if (bSuccess)
+        }
+    }
+
+    ResultJson->SetBoolField(TEXT("bulk_edit_active"), true);
+    ResultJson->SetBoolField(TEXT("undo_recording_disabled"), bBulkEditUndoSuspended);
+    return ResultJson;
+}
+
+// Close the bulk edit session and do one consolidated editor refresh
+TSharedPtr<FJsonObject> UEpicUnrealMCPBridge::EndBulkEdit()
+{
+    TSharedPtr<FJsonObject> ResultJson = MakeShareable(new FJsonObject);
+
+    if (!bBulkEditActive)
+    {
+        ResultJson->SetBoolField(TEXT("success"), false);
+        ResultJson->SetStringField(TEXT("error"), TEXT("No bulk edit session is active"));
+        return ResultJson;
+    }
+
+    if (GEditor)
+    {
+        if (bBulkEditUndoSuspended)
+        {
+            if (UTransBuffer* TransBuffer = Cast<UTransBuffer>(GEditor->Trans))
             {
-                // Set success status and include the result
-                ResponseJson->SetStringField(TEXT("status"), TEXT("success"));
-                ResponseJson->SetObjectField(TEXT("result"), ResultJson);
+                TransBuffer->EnableObjectSerialization();
             }
-            else
+        }
+
+        GEditor->RestoreRealtimeViewports();
+        GEditor->RedrawLevelEditingViewports();
+    }
+
+    bBulkEditActive = false;
+    bBulkEditUndoSuspended = false;
+
+    ResultJson->SetBoolField(TEXT("bulk_edit_active"), false);
+    return ResultJson;
+}
+
+// Streamed execution: recognized commands write their response through
+// ChunkSink in fixed-size chunks as the game thread task iterates, instead of
+// building one payload covering the whole result set. Commands without a
+// streaming path return false so the caller can fall back to ExecuteCommand.
+bool UEpicUnrealMCPBridge::ExecuteCommandStreaming(const FString& CommandType, const TSharedPtr<FJsonObject>& Params, const TSharedPtr<FJsonValue>& RequestId, TFunction<void(const TArray<uint8>&)> ChunkSink)
+{
+    // Only the potentially huge level query has a streaming path so far
+    if (CommandType != TEXT("get_actors_in_level"))
+    {
+        return false;
+    }
+
+    MCP_VERBOSE_LOG(TEXT("EpicUnrealMCPBridge: Executing command (streaming): %s"), *CommandType);
+
+    TPromise<void> Promise;
+    TFuture<void> Future = Promise.GetFuture();
+
+    AsyncTask(ENamedThreads::GameThread, [this, Params, RequestId, ChunkSink = MoveTemp(ChunkSink), Promise = MoveTemp(Promise)]() mutable
+    {
+        EditorCommands->StreamActorsInLevel(Params, RequestId, ChunkSink);
+        Promise.SetValue();
+    });
+
+    Future.Get();
+    return true;
+}
+
+// Dispatch a single command to its handler and wrap the result in a response envelope
+TSharedPtr<FJsonObject> UEpicUnrealMCPBridge::ExecuteCommandOnGameThread(const FString& CommandType, const TSharedPtr<FJsonObject>& Params)
+{
+    TSharedPtr<FJsonObject> ResponseJson = MakeShareable(new FJsonObject);
+    const double StartTime = FPlatformTime::Seconds();
+
+    try
+    {
+        TSharedPtr<FJsonObject> ResultJson;
+
+        // Single hash lookup instead of a string-compare ladder
+        const FMCPCommandHandler* Handler = CommandRegistry.Find(FName(*CommandType));
+        if (Handler)
+        {
+            ResultJson = (*Handler)(Params);
+        }
+        else
+        {
+            ResponseJson->SetStringField(TEXT("status"), TEXT("error"));
+            ResponseJson->SetStringField(TEXT("error"), FString::Printf(TEXT("Unknown command: %s"), *CommandType));
+            return ResponseJson;
+        }
+
+        // Check if the result contains an error
+        bool bSuccess = true;
+        FString ErrorMessage;
+
+        if (ResultJson->HasField(TEXT("success")))
+        {
+            bSuccess = ResultJson->GetBoolField(TEXT("success"));
+            if (!bSuccess && ResultJson->HasField(TEXT("error")))
             {
-                // Set error status and include the error message
-                ResponseJson->SetStringField(TEXT("status"), TEXT("error"));
-                ResponseJson->SetStringField(TEXT("error"), ErrorMessage);
+                ErrorMessage = ResultJson->GetStringField(TEXT("error"));
             }
         }
-        catch (const std::exception& e)
+
+        if (bSuccess)
+        {
+            // Set success status and include the result
+            ResponseJson->SetStringField(TEXT("status"), TEXT("success"));
+            ResponseJson->SetObjectField(TEXT("result"), ResultJson);
+        }
+        else
         {
+            // Set error status and include the error message
             ResponseJson->SetStringField(TEXT("status"), TEXT("error"));
-            ResponseJson->SetStringField(TEXT("error"), UTF8_TO_TCHAR(e.what()));
+            ResponseJson->SetStringField(TEXT("error"), ErrorMessage);
         }
-        
-        FString ResultString;
-        TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&ResultString);
-        FJsonSerializer::Serialize(ResponseJson.ToSharedRef(), Writer);
-        Promise.SetValue(ResultString);
-    });
-    
-    return Future.Get();
+    }
+    catch (const std::exception& e)
+    {
+        ResponseJson->SetStringField(TEXT("status"), TEXT("error"));
+        ResponseJson->SetStringField(TEXT("error"), UTF8_TO_TCHAR(e.what()));
+    }
+
+    FEpicUnrealMCPServerStats::Get().RecordCommand(FName(*CommandType), (FPlatformTime::Seconds() - StartTime) * 1000.0);
+
+    return ResponseJson;
+}
+
+// Execute an array of sub-commands in one pass, avoiding a TCP round trip and
+// a separate game thread hop per command
+TSharedPtr<FJsonObject> UEpicUnrealMCPBridge::ExecuteBatchCommand(const TSharedPtr<FJsonObject>& Params)
+{
+    TSharedPtr<FJsonObject> ResultJson = MakeShareable(new FJsonObject);
+
+    const TArray<TSharedPtr<FJsonValue>>* CommandsArray;
+    if (!Params.IsValid() || !Params->TryGetArrayField(TEXT("commands"), CommandsArray))
+    {
+        ResultJson->SetBoolField(TEXT("success"), false);
+        ResultJson->SetStringField(TEXT("error"), TEXT("Missing 'commands' array parameter"));
+        return ResultJson;
+    }
+
+    TArray<TSharedPtr<FJsonValue>> Results;
+    Results.Reserve(CommandsArray->Num());
+
+    for (const TSharedPtr<FJsonValue>& CommandValue : *CommandsArray)
+    {
+        Results.Add(MakeShared<FJsonValueObject>(ExecuteBatchEntry(CommandValue)));
+    }
+
+    ResultJson->SetArrayField(TEXT("results"), Results);
+    ResultJson->SetNumberField(TEXT("count"), Results.Num());
+    return ResultJson;
+}
+
+// Execute one batch entry and return its response envelope; shared by the
+// all-at-once batch command and the time-sliced variant
+TSharedPtr<FJsonObject> UEpicUnrealMCPBridge::ExecuteBatchEntry(const TSharedPtr<FJsonValue>& CommandValue)
+{
+    const TSharedPtr<FJsonObject>* CommandObject;
+    if (!CommandValue.IsValid() || !CommandValue->TryGetObject(CommandObject))
+    {
+        TSharedPtr<FJsonObject> ErrorJson = MakeShareable(new FJsonObject);
+        ErrorJson->SetStringField(TEXT("status"), TEXT("error"));
+        ErrorJson->SetStringField(TEXT("error"), TEXT("Batch entry is not an object"));
+        return ErrorJson;
+    }
+
+    FString SubCommandType;
+    if (!(*CommandObject)->TryGetStringField(TEXT("type"), SubCommandType))
+    {
+        TSharedPtr<FJsonObject> ErrorJson = MakeShareable(new FJsonObject);
+        ErrorJson->SetStringField(TEXT("status"), TEXT("error"));
+        ErrorJson->SetStringField(TEXT("error"), TEXT("Batch entry missing 'type' field"));
+        return ErrorJson;
+    }
+
+    // Nested batches are rejected to keep each entry a bounded unit of work
+    if (SubCommandType == TEXT("batch") || SubCommandType == TEXT("submit_sliced_batch"))
+    {
+        TSharedPtr<FJsonObject> ErrorJson = MakeShareable(new FJsonObject);
+        ErrorJson->SetStringField(TEXT("status"), TEXT("error"));
+        ErrorJson->SetStringField(TEXT("error"), FString::Printf(TEXT("Nested '%s' commands are not supported"), *SubCommandType));
+        return ErrorJson;
+    }
+
+    TSharedPtr<FJsonObject> SubParams = MakeShareable(new FJsonObject);
+    if ((*CommandObject)->HasField(TEXT("params")))
+    {
+        TSharedPtr<FJsonValue> ParamsValue = (*CommandObject)->TryGetField(TEXT("params"));
+        if (ParamsValue.IsValid() && ParamsValue->Type == EJson::Object)
+        {
+            SubParams = ParamsValue->AsObject();
+        }
+    }
+
+    return ExecuteCommandOnGameThread(SubCommandType, SubParams);
+}
+
+// submit_sliced_batch: like batch, but the entries execute in per-tick slices
+// under a millisecond budget so a 20k-command batch doesn't freeze the editor
+// for its whole duration. Returns a job ID immediately; progress and the
+// final batch result flow through get_job_status / get_job_result.
+TSharedPtr<FJsonObject> UEpicUnrealMCPBridge::SubmitSlicedBatch(const TSharedPtr<FJsonObject>& Params)
+{
+    TSharedPtr<FJsonObject> ResultJson = MakeShareable(new FJsonObject);
+
+    const TArray<TSharedPtr<FJsonValue>>* CommandsArray;
+    if (!Params.IsValid() || !Params->TryGetArrayField(TEXT("commands"), CommandsArray))
+    {
+        ResultJson->SetBoolField(TEXT("success"), false);
+        ResultJson->SetStringField(TEXT("error"), TEXT("Missing 'commands' array parameter"));
+        return ResultJson;
+    }
+
+    double SliceBudgetMs = 10.0;
+    Params->TryGetNumberField(TEXT("slice_budget_ms"), SliceBudgetMs);
+    SliceBudgetMs = FMath::Max(SliceBudgetMs, 1.0);
+
+    const FString JobId = FEpicUnrealMCPJobManager::Get().BeginExternalJob(TEXT("submit_sliced_batch"), CommandsArray->Num());
+
+    // Per-batch execution state shared with the ticker across slices
+    struct FSlicedBatchState
+    {
+        TArray<TSharedPtr<FJsonValue>> Commands;
+        TArray<TSharedPtr<FJsonValue>> Results;
+        int32 NextIndex = 0;
+        int32 SliceCount = 0;
+        double SliceBudgetSeconds = 0.0;
+        FString JobId;
+    };
+
+    TSharedPtr<FSlicedBatchState> State = MakeShared<FSlicedBatchState>();
+    State->Commands = *CommandsArray;
+    State->Results.Reserve(State->Commands.Num());
+    State->SliceBudgetSeconds = SliceBudgetMs / 1000.0;
+    State->JobId = JobId;
+
+    // The ticker runs on the game thread; a weak self pointer lets in-flight
+    // batches die quietly if the subsystem goes away mid-run
+    TWeakObjectPtr<UEpicUnrealMCPBridge> WeakThis(this);
+    FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateLambda([WeakThis, State](float)
+    {
+        UEpicUnrealMCPBridge* Bridge = WeakThis.Get();
+        if (!Bridge)
+        {
+            return false;
+        }
+
+        const double SliceDeadline = FPlatformTime::Seconds() + State->SliceBudgetSeconds;
+        while (State->NextIndex < State->Commands.Num())
+        {
+            State->Results.Add(MakeShared<FJsonValueObject>(Bridge->ExecuteBatchEntry(State->Commands[State->NextIndex])));
+            ++State->NextIndex;
+
+            if (FPlatformTime::Seconds() >= SliceDeadline)
+            {
+                break;
+            }
+        }
+
+        ++State->SliceCount;
+        FEpicUnrealMCPJobManager::Get().SetJobProgress(State->JobId, State->NextIndex);
+
+        if (State->NextIndex < State->Commands.Num())
+        {
+            return true;
+        }
+
+        // Same result shape as batch, wrapped in the envelope get_job_result
+        // returns, plus how many slices the run took
+        TSharedPtr<FJsonObject> BatchResult = MakeShareable(new FJsonObject);
+        BatchResult->SetArrayField(TEXT("results"), State->Results);
+        BatchResult->SetNumberField(TEXT("count"), State->Results.Num());
+        BatchResult->SetNumberField(TEXT("slices"), State->SliceCount);
+
+        TSharedPtr<FJsonObject> Envelope = MakeShareable(new FJsonObject);
+        Envelope->SetStringField(TEXT("status"), TEXT("success"));
+        Envelope->SetObjectField(TEXT("result"), BatchResult);
+
+        FEpicUnrealMCPJobManager::Get().CompleteJob(State->JobId, Envelope);
+        return false;
+    }));
+
+    ResultJson->SetStringField(TEXT("job_id"), JobId);
+    ResultJson->SetNumberField(TEXT("command_count"), CommandsArray->Num());
+    ResultJson->SetNumberField(TEXT("slice_budget_ms"), SliceBudgetMs);
+    return ResultJson;
 }
\ No newline at end of file
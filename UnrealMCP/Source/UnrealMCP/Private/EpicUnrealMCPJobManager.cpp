@@ -0,0 +1,122 @@
+#include "EpicUnrealMCPJobManager.h"
+#include "Async/Async.h"
+#include "Misc/Guid.h"
+
+static const TCHAR* MCPJobStateToString(EMCPJobState State)
+{
+    switch (State)
+    {
+    case EMCPJobState::Queued:    return TEXT("queued");
+    case EMCPJobState::Running:   return TEXT("running");
+    case EMCPJobState::Completed: return TEXT("completed");
+    }
+    return TEXT("unknown");
+}
+
+FEpicUnrealMCPJobManager& FEpicUnrealMCPJobManager::Get()
+{
+    static FEpicUnrealMCPJobManager Instance;
+    return Instance;
+}
+
+FString FEpicUnrealMCPJobManager::SubmitJob(const FString& CommandType, TFunction<TSharedPtr<FJsonObject>()> Work)
+{
+    TSharedPtr<FMCPJob> Job = MakeShared<FMCPJob>();
+    Job->JobId = FGuid::NewGuid().ToString(EGuidFormats::DigitsWithHyphens);
+    Job->CommandType = CommandType;
+    Job->QueuedTime = FPlatformTime::Seconds();
+
+    Jobs.Add(Job->JobId, Job);
+
+    // The work runs as its own game thread task, after the submitting command
+    // has already returned its job ID to the client
+    AsyncTask(ENamedThreads::GameThread, [Job, Work = MoveTemp(Work)]()
+    {
+        Job->State = EMCPJobState::Running;
+        Job->StartTime = FPlatformTime::Seconds();
+        Job->ResponseEnvelope = Work();
+        Job->EndTime = FPlatformTime::Seconds();
+        Job->State = EMCPJobState::Completed;
+    });
+
+    return Job->JobId;
+}
+
+FString FEpicUnrealMCPJobManager::BeginExternalJob(const FString& CommandType, int32 TotalSteps)
+{
+    TSharedPtr<FMCPJob> Job = MakeShared<FMCPJob>();
+    Job->JobId = FGuid::NewGuid().ToString(EGuidFormats::DigitsWithHyphens);
+    Job->CommandType = CommandType;
+    Job->QueuedTime = FPlatformTime::Seconds();
+    Job->StartTime = Job->QueuedTime;
+    Job->State = EMCPJobState::Running;
+    Job->TotalSteps = TotalSteps;
+
+    Jobs.Add(Job->JobId, Job);
+    return Job->JobId;
+}
+
+void FEpicUnrealMCPJobManager::SetJobProgress(const FString& JobId, int32 CompletedSteps)
+{
+    if (const TSharedPtr<FMCPJob>* Job = Jobs.Find(JobId))
+    {
+        (*Job)->CompletedSteps = CompletedSteps;
+    }
+}
+
+void FEpicUnrealMCPJobManager::CompleteJob(const FString& JobId, TSharedPtr<FJsonObject> Envelope)
+{
+    if (const TSharedPtr<FMCPJob>* Job = Jobs.Find(JobId))
+    {
+        (*Job)->ResponseEnvelope = Envelope;
+        (*Job)->CompletedSteps = (*Job)->TotalSteps;
+        (*Job)->EndTime = FPlatformTime::Seconds();
+        (*Job)->State = EMCPJobState::Completed;
+    }
+}
+
+TSharedPtr<FJsonObject> FEpicUnrealMCPJobManager::GetJobStatus(const FString& JobId) const
+{
+    const TSharedPtr<FMCPJob>* Job = Jobs.Find(JobId);
+    if (!Job)
+    {
+        return nullptr;
+    }
+
+    TSharedPtr<FJsonObject> StatusObj = MakeShared<FJsonObject>();
+    StatusObj->SetStringField(TEXT("job_id"), (*Job)->JobId);
+    StatusObj->SetStringField(TEXT("command"), (*Job)->CommandType);
+    StatusObj->SetStringField(TEXT("state"), MCPJobStateToString((*Job)->State));
+
+    if ((*Job)->State == EMCPJobState::Completed)
+    {
+        StatusObj->SetNumberField(TEXT("elapsed_ms"), ((*Job)->EndTime - (*Job)->StartTime) * 1000.0);
+    }
+
+    if ((*Job)->TotalSteps > 0)
+    {
+        StatusObj->SetNumberField(TEXT("completed_steps"), (*Job)->CompletedSteps);
+        StatusObj->SetNumberField(TEXT("total_steps"), (*Job)->TotalSteps);
+    }
+
+    return StatusObj;
+}
+
+TSharedPtr<FJsonObject> FEpicUnrealMCPJobManager::TakeJobResult(const FString& JobId, EMCPJobState& OutState)
+{
+    const TSharedPtr<FMCPJob>* Job = Jobs.Find(JobId);
+    if (!Job)
+    {
+        return nullptr;
+    }
+
+    OutState = (*Job)->State;
+    if (OutState != EMCPJobState::Completed)
+    {
+        return nullptr;
+    }
+
+    TSharedPtr<FJsonObject> Envelope = (*Job)->ResponseEnvelope;
+    Jobs.Remove(JobId);
+    return Envelope;
+}
@@ -3,6 +3,19 @@
 #include "CoreMinimal.h"
 #include "Json.h"
 
+class UEpicUnrealMCPBridge;
+class UMaterialInterface;
+class UMaterialInstanceDynamic;
+
+/** One material known to the cached catalog behind get_available_materials */
+struct FMCPMaterialCatalogEntry
+{
+    FString Name;
+    FString Path;
+    FString Package;
+    FString Class;
+};
+
 /**
  * Handler class for Blueprint-related MCP commands
  */
@@ -11,19 +24,30 @@ class FEpicUnrealMCPBlueprintCommands
 public:
     	FEpicUnrealMCPBlueprintCommands();
 
-    // Handle blueprint commands
+    // Handle blueprint commands (single hash lookup in the handler map)
     TSharedPtr<FJsonObject> HandleCommand(const FString& CommandType, const TSharedPtr<FJsonObject>& Params);
 
+    // Registers every blueprint command with the bridge's dispatch registry
+    void RegisterCommands(UEpicUnrealMCPBridge* Bridge);
+
 private:
+    using FHandlerFunction = TFunction<TSharedPtr<FJsonObject>(const TSharedPtr<FJsonObject>&)>;
+
+    // Command name -> member handler map built once in the constructor
+    TMap<FName, FHandlerFunction> Handlers;
+
     // Specific blueprint command handlers (only used functions)
     TSharedPtr<FJsonObject> HandleCreateBlueprint(const TSharedPtr<FJsonObject>& Params);
     TSharedPtr<FJsonObject> HandleAddComponentToBlueprint(const TSharedPtr<FJsonObject>& Params);
     TSharedPtr<FJsonObject> HandleSetPhysicsProperties(const TSharedPtr<FJsonObject>& Params);
+    TSharedPtr<FJsonObject> HandleSetObjectProperties(const TSharedPtr<FJsonObject>& Params);
     TSharedPtr<FJsonObject> HandleCompileBlueprint(const TSharedPtr<FJsonObject>& Params);
+    TSharedPtr<FJsonObject> HandleCompileBlueprints(const TSharedPtr<FJsonObject>& Params);
     TSharedPtr<FJsonObject> HandleSpawnBlueprintActor(const TSharedPtr<FJsonObject>& Params);
     TSharedPtr<FJsonObject> HandleSetStaticMeshProperties(const TSharedPtr<FJsonObject>& Params);
     TSharedPtr<FJsonObject> HandleSetMeshMaterialColor(const TSharedPtr<FJsonObject>& Params);
-    
+    TSharedPtr<FJsonObject> HandleSetMeshMaterialColors(const TSharedPtr<FJsonObject>& Params);
+
     // Material management functions
     TSharedPtr<FJsonObject> HandleGetAvailableMaterials(const TSharedPtr<FJsonObject>& Params);
     TSharedPtr<FJsonObject> HandleApplyMaterialToActor(const TSharedPtr<FJsonObject>& Params);
@@ -31,5 +55,27 @@ private:
     TSharedPtr<FJsonObject> HandleGetActorMaterialInfo(const TSharedPtr<FJsonObject>& Params);
     TSharedPtr<FJsonObject> HandleGetBlueprintMaterialInfo(const TSharedPtr<FJsonObject>& Params);
 
+    // Cached material catalog, built with one asset registry walk and kept
+    // current through OnAssetAdded/OnAssetRemoved/OnAssetRenamed so
+    // get_available_materials answers from memory
+    static TArray<FMCPMaterialCatalogEntry> MaterialCatalog;
+    static bool bMaterialCatalogBuilt;
+    static bool bMaterialCatalogDelegatesRegistered;
+
+    static bool IsMaterialAsset(const struct FAssetData& AssetData);
+    static void EnsureMaterialCatalogBuilt();
+    static void OnMaterialAssetAdded(const struct FAssetData& AssetData);
+    static void OnMaterialAssetRemoved(const struct FAssetData& AssetData);
+    static void OnMaterialAssetRenamed(const struct FAssetData& AssetData, const FString& OldObjectPath);
+
+    // (outer, base material, parameter, color) -> shared dynamic instance,
+    // so a palette of a few colors across thousands of meshes stays a few
+    // instances per level instead of one per call
+    static TMap<FString, TWeakObjectPtr<UMaterialInstanceDynamic>> ColoredMaterialCache;
 
-}; 
\ No newline at end of file
+    // Returns the cached instance for this pairing, creating it on first
+    // use. Outer must be an object that saves with the colored meshes (the
+    // actors' level, or the component template for blueprint assets) so the
+    // override survives a map save/reload.
+    static UMaterialInstanceDynamic* GetOrCreateColoredMaterial(UObject* Outer, UMaterialInterface* BaseMaterial, const FName& ParameterName, const FLinearColor& Color);
+};
@@ -3,6 +3,10 @@
 #include "CoreMinimal.h"
 #include "Json.h"
 
+class AActor;
+class UEpicUnrealMCPBridge;
+struct FMCPActorSnapshot;
+
 /**
  * Handler class for Editor-related MCP commands
  * Handles viewport control, actor manipulation, and level management
@@ -12,17 +16,65 @@ class UNREALMCP_API FEpicUnrealMCPEditorCommands
 public:
     	FEpicUnrealMCPEditorCommands();
 
-    // Handle editor commands
+    // Handle editor commands (single hash lookup in the handler map)
     TSharedPtr<FJsonObject> HandleCommand(const FString& CommandType, const TSharedPtr<FJsonObject>& Params);
 
+    // Registers every editor command with the bridge's dispatch registry
+    void RegisterCommands(UEpicUnrealMCPBridge* Bridge);
+
+    // Streaming variant of get_actors_in_level: actors are written through
+    // ChunkSink in fixed-size chunks as the level is iterated, so peak memory
+    // stays flat regardless of actor count. RequestId (when valid) is echoed
+    // into every chunk and the final envelope so pipelined clients can
+    // correlate the frames. Must be called on the game thread.
+    void StreamActorsInLevel(const TSharedPtr<FJsonObject>& Params, const TSharedPtr<FJsonValue>& RequestId, const TFunction<void(const TArray<uint8>&)>& ChunkSink);
+
+    // Snapshot half of get_actors_in_level: copies every actor into plain
+    // structs. Must be called on the game thread; the editor hitch for a
+    // full-level query is just this copy. The serialization half writes the
+    // snapshots straight to UTF-8 off the game thread (see the bridge's
+    // SerializeSnapshotResponse).
+    void SnapshotActorsInLevel(TArray<FMCPActorSnapshot>& OutSnapshots);
+
+    // Same split for find_actors_by_name: snapshots every index entry whose
+    // name contains Pattern. Must be called on the game thread.
+    void SnapshotActorsMatchingPattern(const FString& Pattern, TArray<FMCPActorSnapshot>& OutSnapshots);
+
+    // True when Params carries a region filter ('sublevel' or
+    // 'bounds_min'/'bounds_max') that the registry handlers apply; the
+    // bridge's snapshot fast path skips such queries
+    static bool HasRegionFilter(const TSharedPtr<FJsonObject>& Params);
+
 private:
+    using FHandlerFunction = TFunction<TSharedPtr<FJsonObject>(const TSharedPtr<FJsonObject>&)>;
+
+    // Command name -> member handler map built once in the constructor
+    TMap<FName, FHandlerFunction> Handlers;
+
     // Actor manipulation commands
     TSharedPtr<FJsonObject> HandleGetActorsInLevel(const TSharedPtr<FJsonObject>& Params);
     TSharedPtr<FJsonObject> HandleFindActorsByName(const TSharedPtr<FJsonObject>& Params);
     TSharedPtr<FJsonObject> HandleSpawnActor(const TSharedPtr<FJsonObject>& Params);
+    TSharedPtr<FJsonObject> HandleSpawnActorsBulk(const TSharedPtr<FJsonObject>& Params);
+    TSharedPtr<FJsonObject> HandleSpawnInstancedMeshes(const TSharedPtr<FJsonObject>& Params);
     TSharedPtr<FJsonObject> HandleDeleteActor(const TSharedPtr<FJsonObject>& Params);
+    TSharedPtr<FJsonObject> HandleDeleteActorsByPattern(const TSharedPtr<FJsonObject>& Params);
     TSharedPtr<FJsonObject> HandleSetActorTransform(const TSharedPtr<FJsonObject>& Params);
+    TSharedPtr<FJsonObject> HandleSetActorTransformsBulk(const TSharedPtr<FJsonObject>& Params);
+    TSharedPtr<FJsonObject> HandlePreloadAssets(const TSharedPtr<FJsonObject>& Params);
 
     // Blueprint actor spawning
     TSharedPtr<FJsonObject> HandleSpawnBlueprintActor(const TSharedPtr<FJsonObject>& Params);
-}; 
\ No newline at end of file
+
+    // Shared helper mapping an actor type string to the class to spawn
+    static UClass* ResolveActorTypeClass(const FString& ActorType);
+
+    // Fills OutActors from the actor index's region buckets when Params has
+    // a sublevel or bounds filter; returns false when there is no filter and
+    // the caller should query the whole world
+    static bool CollectRegionActors(const TSharedPtr<FJsonObject>& Params, TArray<AActor*>& OutActors);
+
+    // Streamable handles pinned by preload_assets so warmed assets stay
+    // resident until the client releases them (game thread only)
+    static TArray<TSharedPtr<struct FStreamableHandle>> PreloadedAssetHandles;
+};
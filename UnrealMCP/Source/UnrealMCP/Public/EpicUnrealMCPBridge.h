@@ -14,6 +14,9 @@
 
 class FMCPServerRunnable;
 
+/** Signature for a registered MCP command handler */
+using FMCPCommandHandler = TFunction<TSharedPtr<FJsonObject>(const TSharedPtr<FJsonObject>&)>;
+
 /**
  * Editor subsystem for MCP Bridge
  * Handles communication between external tools and the Unreal Editor
@@ -38,10 +41,63 @@ public:
 	void StopServer();
 	bool IsRunning() const { return bIsRunning; }
 
-	// Command execution
-	FString ExecuteCommand(const FString& CommandType, const TSharedPtr<FJsonObject>& Params);
+	// Command execution (synchronous - blocks the calling thread until the
+	// game thread has produced the response). The response is serialized
+	// straight into UTF-8 bytes ready for the socket.
+	void ExecuteCommand(const FString& CommandType, const TSharedPtr<FJsonObject>& Params, TArray<uint8>& OutUtf8Response);
+
+	// Command execution (pipelined - returns immediately; OnComplete is
+	// invoked with the UTF-8 serialized response once the game thread task
+	// has run). RequestId, when valid, is echoed back as the response's 'id'
+	// field so clients can match out-of-order completions.
+	void ExecuteCommandAsync(const FString& CommandType, const TSharedPtr<FJsonObject>& Params, const TSharedPtr<FJsonValue>& RequestId, TFunction<void(const TArray<uint8>&)> OnComplete);
+
+	// Registers a command handler so dispatch is a single hash lookup.
+	// Project code can use this to add handlers without touching the plugin.
+	void RegisterCommand(const FName& CommandType, FMCPCommandHandler Handler);
+
+	// Streaming execution for large result sets: the handler emits fixed-size
+	// UTF-8 response chunks through ChunkSink as it iterates instead of
+	// building one giant payload. Returns false when the command (or its
+	// params) doesn't support streaming, in which case the caller should fall
+	// back to ExecuteCommand. Blocks the calling thread until the final chunk
+	// is sent.
+	bool ExecuteCommandStreaming(const FString& CommandType, const TSharedPtr<FJsonObject>& Params, const TSharedPtr<FJsonValue>& RequestId, TFunction<void(const TArray<uint8>&)> ChunkSink);
+
+	// True while a begin_bulk_edit session is open; mutating handlers use this
+	// to skip per-command viewport refreshes (game thread only)
+	static bool IsBulkEditActive() { return bBulkEditActive; }
 
 private:
+	// Bulk edit session handlers (begin_bulk_edit / end_bulk_edit)
+	TSharedPtr<FJsonObject> BeginBulkEdit(const TSharedPtr<FJsonObject>& Params);
+	TSharedPtr<FJsonObject> EndBulkEdit();
+	// Registers the built-in command set with the dispatch registry
+	void RegisterBuiltInCommands();
+
+	// Dispatches a single command to its handler and wraps the result in a
+	// status/result envelope. Must be called on the game thread.
+	TSharedPtr<FJsonObject> ExecuteCommandOnGameThread(const FString& CommandType, const TSharedPtr<FJsonObject>& Params);
+
+	// Executes an array of sub-commands inside the current game thread task,
+	// returning an array of per-command envelopes.
+	TSharedPtr<FJsonObject> ExecuteBatchCommand(const TSharedPtr<FJsonObject>& Params);
+
+	// Executes one batch entry (shared by batch and submit_sliced_batch) and
+	// returns its response envelope. Must be called on the game thread.
+	TSharedPtr<FJsonObject> ExecuteBatchEntry(const TSharedPtr<FJsonValue>& CommandValue);
+
+	// submit_sliced_batch handler: runs batch entries in per-tick slices under
+	// a millisecond budget so the editor stays interactive; progress and the
+	// final result are reported through the async job API.
+	TSharedPtr<FJsonObject> SubmitSlicedBatch(const TSharedPtr<FJsonObject>& Params);
+
+	// Builds and serializes the get_actors_in_level response from plain-struct
+	// snapshots; runs on the socket thread or a background worker so the game
+	// thread only pays for the snapshot copy.
+	void SerializeSnapshotResponse(const TArray<struct FMCPActorSnapshot>& Snapshots, const TSharedPtr<FJsonValue>& RequestId, const TOptional<uint64>& SceneVersion, TArray<uint8>& OutUtf8Response);
+
+
 	// Server state
 	bool bIsRunning;
 	TSharedPtr<FSocket> ListenerSocket;
@@ -55,4 +111,11 @@ private:
 	// Command handler instances
 	TSharedPtr<FEpicUnrealMCPEditorCommands> EditorCommands;
 	TSharedPtr<FEpicUnrealMCPBlueprintCommands> BlueprintCommands;
-}; 
\ No newline at end of file
+
+	// Command name -> handler dispatch registry
+	TMap<FName, FMCPCommandHandler> CommandRegistry;
+
+	// Bulk edit session state (game thread only)
+	static bool bBulkEditActive;
+	static bool bBulkEditUndoSuspended;
+};
\ No newline at end of file
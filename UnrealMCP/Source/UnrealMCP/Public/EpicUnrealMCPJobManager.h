@@ -0,0 +1,70 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Json.h"
+
+/** Lifecycle of an async job */
+enum class EMCPJobState : uint8
+{
+    Queued,
+    Running,
+    Completed
+};
+
+/** One submitted job and, once finished, its response envelope */
+struct FMCPJob
+{
+    FString JobId;
+    FString CommandType;
+    EMCPJobState State = EMCPJobState::Queued;
+    TSharedPtr<FJsonObject> ResponseEnvelope;
+    double QueuedTime = 0.0;
+    double StartTime = 0.0;
+    double EndTime = 0.0;
+
+    // Step progress for jobs that advance incrementally (0 total = no
+    // progress reporting)
+    int32 CompletedSteps = 0;
+    int32 TotalSteps = 0;
+};
+
+/**
+ * Registry for long-running commands submitted through submit_job.
+ *
+ * A submitted job returns its ID immediately instead of holding the socket
+ * thread hostage behind ExecuteCommand's Future.Get(); the work itself runs
+ * in its own game thread task and the caller polls get_job_status /
+ * get_job_result. All access happens on the game thread (commands execute
+ * there), so no locking.
+ */
+class UNREALMCP_API FEpicUnrealMCPJobManager
+{
+public:
+    static FEpicUnrealMCPJobManager& Get();
+
+    // Queues Work as its own game thread task and returns the new job's ID
+    FString SubmitJob(const FString& CommandType, TFunction<TSharedPtr<FJsonObject>()> Work);
+
+    // Creates a Running job whose work is driven externally (e.g. a ticker
+    // executing per-tick slices); the driver reports progress and finishes it
+    // with CompleteJob. TotalSteps > 0 enables progress in get_job_status.
+    FString BeginExternalJob(const FString& CommandType, int32 TotalSteps);
+
+    // Updates an externally driven job's completed step count
+    void SetJobProgress(const FString& JobId, int32 CompletedSteps);
+
+    // Stores the finished envelope and marks an externally driven job Completed
+    void CompleteJob(const FString& JobId, TSharedPtr<FJsonObject> Envelope);
+
+    // Returns the job's state without its result, or nullptr if unknown
+    TSharedPtr<FJsonObject> GetJobStatus(const FString& JobId) const;
+
+    // Returns the finished job's response envelope and drops the job, or
+    // nullptr if the job is unknown; OutState reports why when not completed
+    TSharedPtr<FJsonObject> TakeJobResult(const FString& JobId, EMCPJobState& OutState);
+
+private:
+    FEpicUnrealMCPJobManager() = default;
+
+    TMap<FString, TSharedPtr<FMCPJob>> Jobs;
+};
@@ -0,0 +1,17 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+// Per-message logging on the server hot path (full request/response text,
+// per-step traces) is compiled out by default; flip UNREALMCP_VERBOSE_LOGGING
+// to 1 in UnrealMCP.Build.cs when debugging the wire protocol. Errors and
+// warnings about real failures stay as plain UE_LOG calls.
+#ifndef UNREALMCP_VERBOSE_LOGGING
+#define UNREALMCP_VERBOSE_LOGGING 0
+#endif
+
+#if UNREALMCP_VERBOSE_LOGGING
+#define MCP_VERBOSE_LOG(Format, ...) UE_LOG(LogTemp, Display, Format, ##__VA_ARGS__)
+#else
+#define MCP_VERBOSE_LOG(Format, ...)
+#endif
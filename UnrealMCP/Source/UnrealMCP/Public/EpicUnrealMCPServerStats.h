@@ -0,0 +1,53 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Json.h"
+#include <atomic>
+
+/** Latency accounting for one command type */
+struct FMCPCommandTypeStats
+{
+    int64 Count = 0;
+    double TotalMs = 0.0;
+    double MaxMs = 0.0;
+
+    // Histogram buckets: <1ms, <5ms, <10ms, <50ms, <100ms, <500ms, >=500ms
+    static constexpr int32 NumLatencyBuckets = 7;
+    int64 LatencyBuckets[NumLatencyBuckets] = { 0 };
+};
+
+/**
+ * Lightweight server counters that replace per-message hot-path logging.
+ *
+ * Byte counters are atomics because the connection threads bump them; the
+ * per-command-type latency map is only touched from the game thread where
+ * commands execute, so it needs no lock. Snapshots for get_server_stats are
+ * taken on the game thread too.
+ */
+class UNREALMCP_API FEpicUnrealMCPServerStats
+{
+public:
+    static FEpicUnrealMCPServerStats& Get();
+
+    // Any thread
+    void RecordBytesReceived(int64 Bytes) { BytesReceived.fetch_add(Bytes, std::memory_order_relaxed); }
+    void RecordBytesSent(int64 Bytes) { BytesSent.fetch_add(Bytes, std::memory_order_relaxed); }
+
+    // Game thread only
+    void RecordCommand(const FName& CommandType, double ElapsedMs);
+
+    // Game thread only - builds the get_server_stats payload
+    TSharedPtr<FJsonObject> ToJson() const;
+
+    // Game thread only
+    void Reset();
+
+private:
+    FEpicUnrealMCPServerStats() = default;
+
+    std::atomic<int64> CommandsProcessed{ 0 };
+    std::atomic<int64> BytesReceived{ 0 };
+    std::atomic<int64> BytesSent{ 0 };
+
+    TMap<FName, FMCPCommandTypeStats> CommandStats;
+};
@@ -0,0 +1,103 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "HAL/Runnable.h"
+#include "HAL/ThreadSafeBool.h"
+#include "Sockets.h"
+
+class UEpicUnrealMCPBridge;
+class FRunnableThread;
+
+/**
+ * Services a single connected MCP client on its own thread.
+ *
+ * Each connection owns its receive buffer and framing state, so multiple
+ * tools can stay connected concurrently; commands from every client are
+ * funneled through the shared bridge's ExecuteCommand path.
+ *
+ * Messages on the wire are a 4-byte big-endian payload size followed by
+ * UTF-8 JSON, with a legacy unframed mode for clients that open with a
+ * bare '{'.
+ *
+ * Framed clients can negotiate compression with a set_protocol_options
+ * message; once enabled, responses over the threshold are sent deflated
+ * with the high bit of the length prefix set and the uncompressed size
+ * in the 4 bytes after it.
+ *
+ * Requests carrying an 'id' field are executed through the bridge's
+ * asynchronous path: the receive loop keeps reading while the command
+ * runs and the response (tagged with the same id) is sent whenever it
+ * completes, so clients can pipeline many in-flight commands.
+ */
+class FMCPClientConnection : public FRunnable, public TSharedFromThis<FMCPClientConnection>
+{
+public:
+	FMCPClientConnection(UEpicUnrealMCPBridge* InBridge, TSharedPtr<FSocket> InClientSocket);
+	virtual ~FMCPClientConnection();
+
+	// FRunnable interface
+	virtual bool Init() override;
+	virtual uint32 Run() override;
+	virtual void Stop() override;
+	virtual void Exit() override;
+
+	// Spawns the servicing thread for this connection
+	void Start();
+
+	// True once the servicing thread has exited its receive loop
+	bool IsFinished() const { return bFinished; }
+
+	// Stops the connection and joins its thread
+	void Shutdown();
+
+protected:
+	// Extracts and dispatches every complete message currently in ReceiveBuffer.
+	// Returns false on a protocol error that should drop the connection.
+	bool ProcessReceiveBuffer();
+
+	// Parses one UTF-8 JSON message, executes the command, and sends the
+	// response; the payload is parsed in place without a TCHAR transcode
+	void ProcessMessage(TArrayView<const uint8> Utf8Payload, bool bFramed);
+
+	// Sends a UTF-8 response, length-prefixed when the request was framed.
+	// Compresses payloads over the negotiated threshold when the client
+	// enabled compression.
+	bool SendResponse(const TArray<uint8>& Utf8Payload, bool bFramed);
+
+	// Handles the transport-level set_protocol_options handshake without a
+	// round trip through the bridge; replies with the accepted options
+	void HandleSetProtocolOptions(const TSharedPtr<FJsonObject>& Params, bool bFramed);
+
+private:
+	// Upper bound on a single framed payload, guarding against corrupt prefixes
+	static constexpr uint32 MaxFramePayloadSize = 64 * 1024 * 1024;
+
+	// High bit of the length prefix marks a compressed frame; the payload
+	// size limit stays well below it
+	static constexpr uint32 CompressedFrameFlag = 0x80000000u;
+
+	// Responses smaller than this go uncompressed by default - deflate
+	// overhead only pays off once a payload spans many socket buffers
+	static constexpr int32 DefaultCompressionThresholdBytes = 64 * 1024;
+
+	UEpicUnrealMCPBridge* Bridge;
+	TSharedPtr<FSocket> ClientSocket;
+	FRunnableThread* Thread;
+	TArray<uint8> ReceiveBuffer;
+	FThreadSafeBool bRunning;
+	FThreadSafeBool bFinished;
+
+	// Serializes sends from the receive thread and async completion callbacks
+	FCriticalSection SendCriticalSection;
+
+	// Pooled per-connection send buffer: Reset() keeps the grown capacity, so
+	// after warm-up a response costs zero heap allocations regardless of how
+	// many commands the session runs. Guarded by SendCriticalSection.
+	TArray<uint8> SendScratchBuffer;
+
+	// Compression state negotiated via set_protocol_options, plus the pooled
+	// deflate output buffer. All guarded by SendCriticalSection.
+	bool bCompressResponses = false;
+	int32 CompressionThresholdBytes = DefaultCompressionThresholdBytes;
+	TArray<uint8> CompressScratchBuffer;
+};
@@ -6,9 +6,14 @@
 #include "Interfaces/IPv4/IPv4Address.h"
 
 class UEpicUnrealMCPBridge;
+class FMCPClientConnection;
 
 /**
- * Runnable class for the MCP server thread
+ * Runnable class for the MCP server accept thread.
+ *
+ * Accepts connections and hands each one to an FMCPClientConnection that
+ * services it on its own thread, so multiple clients (e.g. the Python
+ * server plus an ad-hoc debugging tool) can issue commands concurrently.
  */
 class FMCPServerRunnable : public FRunnable
 {
@@ -23,12 +28,15 @@ public:
 	virtual void Exit() override;
 
 protected:
-	void HandleClientConnection(TSharedPtr<FSocket> ClientSocket);
-	void ProcessMessage(TSharedPtr<FSocket> Client, const FString& Message);
+	// Drops connections whose servicing thread has finished
+	void PruneFinishedConnections();
+
+	// Stops and joins every active connection
+	void ShutdownAllConnections();
 
 private:
 	UEpicUnrealMCPBridge* Bridge;
 	TSharedPtr<FSocket> ListenerSocket;
-	TSharedPtr<FSocket> ClientSocket;
+	TArray<TSharedPtr<FMCPClientConnection>> Connections;
 	bool bRunning;
-}; 
\ No newline at end of file
+};